@@ -0,0 +1,368 @@
+#!/usr/bin/env python3
+# This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova
+#
+# Generates src/locale/locales.h from the keyboard layouts in src/locale/win and src/locale/mac.
+#
+# The layouts stay the place where characters are added or changed, this script packs them:
+#  - ASCII is stored as the differences to the US layout (char, modifiers, key)
+#  - UTF-8 sequences become 16 bit code points, sorted so they can be binary searched
+#  - Rows that can never match (shadowed by an earlier one) are dropped
+#  - Tables that are identical in several layouts are only stored once
+#  - locale_names lists every layout sorted by name, for the binary search of locale::get()
+#  - Every layout is wrapped in #if, so a build can pick some of them (see config.h)
+#
+# Standalone:  python scripts/locale_gen.py [--report]
+# PlatformIO:  runs before every build (only writes when a layout changed),
+#              'pio run -t locales' regenerates and prints the flash usage of every layout,
+#              'custom_locales = DE US_MAC' builds only those layouts in
+
+import os
+import re
+import sys
+
+BASE = "us_win"
+
+ASCII_WIDTH = 2 # Modifier(s), Key
+UTF8_WIDTH  = 6 # UTF-8 (4 bytes), Modifier(s), Key
+COMB_WIDTH  = 8 # UTF-8 (4 bytes), Modifier(s), Key, Modifier(s), Key
+
+# Packed tables: name, bytes of the character, comment
+TABLES = (
+    ("ascii", 1, "Char, Modifier(s), Key"),
+    ("utf8", 2, "Code point (little endian), Modifier(s), Key"),
+    ("combinations", 2, "Code point (little endian), Modifier(s), Key, Modifier(s), Key"),
+)
+
+HEADER = """/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+// Generated by scripts/locale_gen.py from the layouts in locale/win and locale/mac, don't edit!
+
+#pragma once
+
+#include "locale/locale_types.h"
+#include "locale/usb_hid_keys.h"
+"""
+
+
+def read_defines(path):
+    defines = {}
+
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            m = re.match(r"\s*#define\s+(\w+)\s+(0x[0-9A-Fa-f]+|\d+)", line)
+            if m:
+                defines[m.group(1)] = int(m.group(2), 0)
+
+    return defines
+
+
+def value(token, defines):
+    expr = re.sub(r"\b[A-Za-z_]\w*", lambda m: str(defines[m.group(0)]), token)
+
+    if not re.fullmatch(r"[0-9xXa-fA-F|()\s]+", expr):
+        raise ValueError("Can't evaluate '%s'" % token)
+
+    return eval(expr)
+
+
+def read_array(text, name, width, defines):
+    # Returns rows of (tokens, values, comment), the layouts have one row per line
+    m = re.search(r"const uint8_t " + name + r"\[\] = \{(.*?)\n\};", text, re.S)
+
+    if not m:
+        raise ValueError("%s not found" % name)
+
+    rows    = []
+    pending = []
+
+    for line in m.group(1).split("\n"):
+        code, _, comment = line.partition("//")
+
+        pending += [t.strip() for t in code.split(",") if t.strip()]
+
+        while len(pending) >= width:
+            tokens  = pending[:width]
+            pending = pending[width:]
+            rows.append((tokens, [value(t, defines) for t in tokens], comment.strip()))
+
+    if pending:
+        raise ValueError("%s has an incomplete row" % name)
+
+    return rows
+
+
+def code_point(values):
+    utf8 = bytes(v for v in values[:4] if v != 0)
+    return ord(utf8.decode("utf-8"))
+
+
+def layout_paths(src_dir):
+    paths = []
+
+    for platform in ("mac", "win"):
+        folder = os.path.join(src_dir, "locale", platform)
+        paths += [os.path.join(folder, f) for f in sorted(os.listdir(folder)) if f.endswith(".h")]
+
+    return paths
+
+
+def layout_name(path):
+    return os.path.basename(path)[len("locale_"):-len(".h")]
+
+
+def read_layout(path, defines):
+    name = layout_name(path)
+
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+
+    return {
+        "name": name,
+        "ascii": read_array(text, "ascii_" + name, ASCII_WIDTH, defines),
+        "utf8": read_array(text, "utf8_" + name, UTF8_WIDTH, defines),
+        "combinations": read_array(text, "combinations_" + name, COMB_WIDTH, defines),
+    }
+
+
+def pack(layout, base):
+    if len(layout["ascii"]) != 128:
+        raise ValueError("ascii_%s must have 128 rows" % layout["name"])
+
+    # Characters resolve in the order combinations, ASCII, UTF-8; the first row of a character wins
+    seen         = set()
+    combinations = []
+    utf8         = []
+
+    for tokens, values, comment in layout["combinations"]:
+        cp = code_point(values)
+
+        if cp not in seen:
+            seen.add(cp)
+            combinations.append((cp, tokens[4:], values[4:], comment))
+
+    seen.update(range(128))
+
+    for tokens, values, comment in layout["utf8"]:
+        cp = code_point(values)
+
+        if cp not in seen:
+            seen.add(cp)
+            utf8.append((cp, tokens[4:], values[4:], comment))
+
+    ascii = []
+
+    for c, (row, base_row) in enumerate(zip(layout["ascii"], base["ascii"])):
+        if row[1] != base_row[1]:
+            ascii.append((c, row[0], row[1], row[2]))
+
+    combinations.sort(key=lambda r: r[0])
+    utf8.sort(key=lambda r: r[0])
+
+    return { "ascii": ascii, "utf8": utf8, "combinations": combinations }
+
+
+def format_rows(rows, key_bytes):
+    lines = []
+
+    for i, (key, tokens, _, comment) in enumerate(rows):
+        if key_bytes == 0:
+            cols = []
+        elif key_bytes == 1:
+            cols = ["0x%02X, " % key]
+        else:
+            cols = ["0x%02X, 0x%02X, " % (key & 0xFF, key >> 8)]
+
+        for j, t in enumerate(tokens):
+            last = (i == len(rows) - 1) and (j == len(tokens) - 1)
+            cols.append((t if last else t + ",").ljust(23 if j % 2 == 0 else 19) + " ")
+
+        line = "    " + "".join(cols)
+        lines.append(line + "// " + comment if comment else line.rstrip())
+
+    return "\n".join(lines)
+
+
+def locale_id(name):
+    return re.sub(r"_WIN$", "", name.upper())
+
+
+def guard(ids):
+    return "#if defined(LOCALE_ALL) || " + " || ".join("defined(LOCALE_%s)" % i for i in ids)
+
+
+def table_size(rows, key_bytes):
+    return sum(key_bytes + len(r[1]) for r in rows)
+
+
+def generate(src_dir):
+    locale_dir = os.path.join(src_dir, "locale")
+    defines    = read_defines(os.path.join(locale_dir, "usb_hid_keys.h"))
+
+    layouts = [read_layout(p, defines) for p in layout_paths(src_dir)]
+    base    = next(l for l in layouts if l["name"] == BASE)
+
+    # Name for locale::get() and the LOCALE_<NAME> define: the file name without the _win suffix,
+    # i.e. locale_ca_fr_win.h -> CA_FR, locale_de_mac.h -> DE_MAC
+    for layout in layouts:
+        layout["id"] = locale_id(layout["name"])
+
+    tables = {} # Content of a table -> { name, rows, key bytes, comment, ids of the layouts using it }
+    report = []
+
+    for layout in layouts:
+        layout["packed"] = pack(layout, base)
+        layout["tables"] = {}
+
+        for kind, key_bytes, comment in TABLES:
+            rows    = layout["packed"][kind]
+            content = (kind, tuple((r[0], tuple(r[2])) for r in rows))
+
+            if content not in tables:
+                tables[content] = {
+                    "name": "%s_%s" % (kind, layout["name"]),
+                    "owner": layout["name"],
+                    "rows": rows,
+                    "key_bytes": key_bytes,
+                    "comment": comment,
+                    "ids": [],
+                }
+
+            tables[content]["ids"].append(layout["id"])
+            layout["tables"][kind] = tables[content]
+
+    ids = sorted(l["id"] for l in layouts)
+
+    out = [HEADER]
+    out.append("// Without any LOCALE_<NAME> define all layouts are built in")
+    out.append("#if " + " && \\\n    ".join(" && ".join("!defined(LOCALE_%s)" % i for i in ids[j:j + 4]) for j in range(0, len(ids), 4)))
+    out.append("#define LOCALE_ALL\n#endif\n")
+
+    out.append("// Modifier(s), Key\ninline constexpr uint8_t ascii_base[] = {")
+    out.append(format_rows([(None, t, v, c) for t, v, c in base["ascii"]], 0) + "\n};\n")
+
+    total_old = 0
+    total_new = len(base["ascii"]) * ASCII_WIDTH
+
+    for layout in layouts:
+        name   = layout["name"]
+        shared = set()
+        size   = 0
+
+        for kind, _, _ in TABLES:
+            t = layout["tables"][kind]
+
+            if t["owner"] != name:
+                shared.add(t["owner"])
+                continue
+
+            size += table_size(t["rows"], t["key_bytes"])
+
+            out.append(guard(t["ids"]))
+            out.append("// %s\ninline constexpr uint8_t %s[] = {" % (t["comment"], t["name"]))
+            out.append(format_rows(t["rows"], t["key_bytes"]) + ("\n" if t["rows"] else "") + "};")
+            out.append("#endif\n")
+
+        names = { kind: layout["tables"][kind]["name"] for kind, _, _ in TABLES }
+
+        out.append(guard([layout["id"]]))
+        out.append("inline constexpr hid_locale_t locale_%s {" % name)
+        out.append("    %s, sizeof(%s) / 3," % (names["ascii"], names["ascii"]))
+        out.append("    %s, sizeof(%s) / 4," % (names["utf8"], names["utf8"]))
+        out.append("    %s, sizeof(%s) / 6," % (names["combinations"], names["combinations"]))
+        out.append("};")
+        out.append("#endif\n")
+
+        old = len(layout["ascii"]) * ASCII_WIDTH + len(layout["utf8"]) * UTF8_WIDTH + len(layout["combinations"]) * COMB_WIDTH
+
+        total_old += old
+        total_new += size
+        report.append("%-12s %6d -> %5d bytes (-%d)%s" % (name, old, size, old - size,
+                                                          ", shares tables of " + ", ".join(sorted(shared)) if shared else ""))
+
+    out.append("// Names for locale::get(), sorted")
+    out.append("inline constexpr hid_locale_name_t locale_names[] = {")
+
+    for layout in sorted(layouts, key=lambda l: l["id"]):
+        out.append(guard([layout["id"]]))
+        out.append("    { \"%s\", &locale_%s }," % (layout["id"], layout["name"]))
+        out.append("#endif")
+
+    out.append("};\n")
+
+    report.append("%-12s %6d -> %5d bytes (-%d, base layout included)" % ("total", total_old, total_new, total_old - total_new))
+
+    return "\n".join(out).rstrip("\n"), report
+
+
+# Defines for the layouts of 'custom_locales = DE US_MAC' in platformio.ini
+def select(project_dir, selection):
+    names = { locale_id(layout_name(p)): layout_name(p) for p in layout_paths(os.path.join(project_dir, "src")) }
+    ids   = [locale_id(n.replace("-", "_")) for n in selection.replace(",", " ").split()]
+
+    for i in ids:
+        if i not in names:
+            raise ValueError("Unknown locale '%s' in custom_locales" % i)
+
+    defines = ["LOCALE_" + i for i in ids]
+
+    # A single layout is compiled into the keyboard lookup
+    if len(ids) == 1:
+        defines.append(("LOCALE_FIXED", "locale_" + names[ids[0]]))
+
+    return defines
+
+
+def run(project_dir, force=False, show_report=False):
+    src_dir = os.path.join(project_dir, "src")
+    target  = os.path.join(src_dir, "locale", "locales.h")
+
+    sources = [os.path.abspath(__file__) if "__file__" in globals() else target]
+
+    for root, _, files in os.walk(os.path.join(src_dir, "locale")):
+        sources += [os.path.join(root, f) for f in files if f != "locales.h"]
+
+    if not force and os.path.exists(target):
+        if os.path.getmtime(target) >= max(os.path.getmtime(s) for s in sources):
+            return
+
+    text, report = generate(src_dir)
+
+    old_text = None
+
+    if os.path.exists(target):
+        with open(target, encoding="utf-8") as f:
+            old_text = f.read()
+
+    if text != old_text:
+        with open(target, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+        print("Generated %s" % os.path.relpath(target, project_dir))
+    else:
+        os.utime(target)
+
+    if show_report:
+        print("\n".join(report))
+
+
+try:
+    Import("env") # PlatformIO (SCons) extra script
+except NameError:
+    env = None
+
+if env is not None:
+    project_dir = env.subst("$PROJECT_DIR")
+    script      = os.path.join(project_dir, "scripts", "locale_gen.py")
+
+    run(project_dir)
+
+    env.Append(CPPDEFINES=select(project_dir, env.GetProjectOption("custom_locales", "")))
+
+    env.AddCustomTarget(
+        name="locales",
+        dependencies=None,
+        actions=['"$PYTHONEXE" "%s" --report' % script],
+        title="Locales",
+        description="Regenerate src/locale/locales.h and show its flash usage",
+    )
+elif __name__ == "__main__":
+    run(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), force=True, show_report="--report" in sys.argv)
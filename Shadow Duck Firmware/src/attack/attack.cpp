@@ -6,98 +6,170 @@
 #include "debug.h"
 
 #include "msc/msc.h"
+#include "attack/prefetch.h"
 #include "duckparser/duckparser.h"
 #include "preferences/preferences.h"
 #include "led/led.h"
 #include "hid/hid.h"
 #include "hid/keyboard.h"
+#include "tasks/tasks.h"
 
 namespace attack {
     // ====== PRIVATE ====== //
+    void wait_host(uint32_t timeout) {
+        unsigned long start_time = millis();
 
-    // ====== PUBLIC ====== //
-    void start(const char* path) {
+        while (!hid::ready() && (millis() - start_time < timeout)) {
+            tasks::update();
+            yield();
+        }
+
+        debugF("Host ready after ");
+        debug(millis() - start_time);
+        debuglnF(" ms");
+    }
+
+    void run(const char* path, uint32_t timeout) {
         // If script doesn't exist, don't do anything
         if (!msc::exists(path)) return;
 
+        // Erasing flash would stall the keystrokes, writes of the host wait in the cache
+        msc::pauseSync();
+
         // Set attack color
         led::setColor(preferences::getAttackColor());
 
+        // Open main BadUSB script
+        msc::open(preferences::getMainScript());
+        duckparser::clearCache();
+
+        // Lines are read and compiled ahead (on core1 of the RP2040)
+        prefetch::start();
+
+        // The first lines are compiled while the host is still getting ready
+        if (timeout > 0) wait_host(timeout);
+
         // Disable capslock if needed
         if (preferences::getDisableCapslock()) {
             keyboard::disableCapslock();
+            hid::flush();
             delay(10);
             hid::indicatorChanged();
         }
 
-        // Open main BadUSB script
-        msc::open(preferences::getMainScript().c_str());
-
-        // Read and parse file
-        char buffer[READ_BUFFER];
-
-        size_t   len      = 0;
         uint32_t prev_pos = 0;
         uint32_t cur_pos  = 0;
+        uint32_t next_pos = 0;
+        bool in_line      = false;
         int repeats       = 0;
 
         // For LOOP_BEGIN and LOOP_END
         uint32_t start_pos = 0;
         int loops          = 0;
 
+        // For reading a line again (REPEAT/REPLAY)
+        char buffer[READ_BUFFER];
+        const char* line = buffer;
+        size_t len       = 0;
+
         while (true) {
             debugF("Reading line...");
-            if (!msc::getInLine()) cur_pos = msc::getPosition();
-            len = msc::readLine(buffer, READ_BUFFER);
+            const prefetch::line_t* l = prefetch::next();
+
+            if (l->line_begin) cur_pos = l->pos;
 
             // Reached end of file
-            if (len == 0) {
+            if (l->text_len == 0) {
                 debuglnF("Reached end of file");
-                if (msc::openNextFile()) continue;
-                else break;
+                prefetch::release();
+                prefetch::stop();
+
+                if (msc::openNextFile()) {
+                    prefetch::start();
+                    continue;
+                } else {
+                    break;
+                }
             }
 
-            debugln(len);
-            debugln(std::string(buffer, len-1).c_str());
+            debugln(l->text_len);
+
+            debugF("Running...");
+            duckparser::run(l->program, l->len, !l->in_line);
 
-            debugF("Parsing...");
-            duckparser::parse(buffer, len);
+            in_line  = l->in_line;
+            next_pos = l->next_pos;
+            prefetch::release();
 
             // For REPEAT/REPLAY
             repeats = duckparser::getRepeats();
 
             for (int i = 0; i<repeats; ++i) {
+                // Replay from RAM, or read the line again if it was too large
+                if (duckparser::replayLine()) continue;
+
+                prefetch::stop();
                 msc::gotoPosition(prev_pos);
 
                 do {
-                    len = msc::readLine(buffer, READ_BUFFER);
-                    duckparser::parse(buffer, len);
+                    len = msc::readLine(buffer, READ_BUFFER, &line);
+                    duckparser::parseAgain(line, len, line != buffer);
                 } while (msc::getInLine());
+
+                // Continue after the REPEAT line
+                msc::gotoPosition(next_pos);
+                prefetch::start();
             }
 
-            if (!msc::getInLine()) prev_pos = cur_pos;
+            if (!in_line) prev_pos = cur_pos;
 
             // For LOOP_BEGIN/LOOP_END
             if (duckparser::loopBegin()) {
-                start_pos = msc::getPosition();
+                start_pos = next_pos;
                 loops     = duckparser::getLoops();
             } else if (duckparser::loopEnd() && (loops > 1)) {
-                msc::gotoPosition(start_pos);
-                --loops;
+                // Replay from RAM, or read the loop body again if it was too large
+                while ((loops > 1) && duckparser::replayLoop()) --loops;
+
+                if (loops > 1) {
+                    prefetch::stop();
+                    msc::gotoPosition(start_pos);
+                    prefetch::start();
+                    --loops;
+                }
             }
 
             // For IMPORT
             if (duckparser::import()) {
                 std::string path = duckparser::getImport();
+
+                prefetch::stop();
                 msc::open(path.c_str());
+                prefetch::start();
             }
 
             debuglnF("OK");
         }
+        hid::flush();
+        msc::resumeSync();
         debuglnF("Attack finished");
+
+        debugF("Parser arena peak: ");
+        debug(duckparser::getArenaPeak());
+        debugF("/");
+        debugln(PARSER_ARENA_SIZE);
+    }
+
+    // ====== PUBLIC ====== //
+    void start(const char* path) {
+        run(path, 0);
     }
 
     void start() {
-        start(preferences::getMainScript().c_str());
+        start(preferences::getMainScript());
+    }
+
+    void startWhenReady(uint32_t timeout) {
+        run(preferences::getMainScript(), timeout);
     }
 }
\ No newline at end of file
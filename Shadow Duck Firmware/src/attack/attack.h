@@ -2,7 +2,13 @@
 
 #pragma once
 
+#include <stdint.h> // uint32_t
+
 namespace attack {
     void start(const char* path);
     void start();
+
+    // Opens and compiles the start of the main script while waiting for the host
+    // to be ready for keystrokes (at most timeout ms), then runs it
+    void startWhenReady(uint32_t timeout);
 }
\ No newline at end of file
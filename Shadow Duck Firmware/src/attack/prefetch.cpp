@@ -0,0 +1,161 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#include "attack/prefetch.h"
+
+#include "debug.h"
+
+#include "msc/msc.h"
+#include "duckparser/duckparser.h"
+#include "tasks/tasks.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <hardware/sync.h> // __sev()
+#endif // if defined(ARDUINO_ARCH_RP2040)
+
+namespace prefetch {
+    // ====== PRIVATE ====== //
+    // Ring with a single producer (core1 on RP2040) and a single consumer (core0).
+    // Only the producer increments head, only the consumer increments tail.
+    line_t lines[PREFETCH_SLOTS];
+
+    volatile uint32_t head = 0; // Next line to produce
+    volatile uint32_t tail = 0; // Next line to consume
+
+    volatile bool running = false; // Producer may read and compile
+    volatile bool idle    = true;  // Producer isn't working right now
+
+    bool done    = false; // Producer reached the end of the file
+    bool in_line = false; // Last read ended in the middle of a line
+
+    char buffer[READ_BUFFER];
+
+    // Wakes the producer, if it sleeps in loop1()
+    void wake() {
+#if defined(ARDUINO_ARCH_RP2040)
+        __sev();
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+
+    bool produce() {
+        if (done || (head - tail >= PREFETCH_SLOTS)) return false;
+
+        line_t* l        = &lines[head % PREFETCH_SLOTS];
+        const char* text = buffer;
+
+        l->state      = duckparser::save_state();
+        l->line_begin = !in_line;
+
+        msc::lock();
+        l->pos      = msc::getPosition();
+        l->text_len = msc::readLine(buffer, READ_BUFFER, &text);
+
+        if (l->text_len > 0) in_line = msc::getInLine();
+
+        l->next_pos = msc::getPosition();
+        msc::unlock();
+
+        if (l->text_len > 0) {
+            size_t consumed;
+
+            // Memory mapped text stays in flash until the file is closed (see msc.cpp),
+            // so it's compiled in place and strings refer to it
+            l->len = duckparser::compile(text, l->text_len, l->program, PROGRAM_SIZE, &consumed, text != buffer) - 1;
+
+            if (consumed == 0) {
+                debugln("Error, line doesn't fit into PROGRAM_SIZE");
+                consumed = l->text_len;
+            }
+
+            // Program is full, the rest of the line is read and compiled again with the next slot
+            if (consumed < l->text_len) {
+                msc::lock();
+                msc::gotoPosition(l->pos + consumed);
+                msc::unlock();
+
+                l->text_len = consumed;
+                l->next_pos = l->pos + consumed;
+                in_line     = true;
+            }
+        } else {
+            done          = true;
+            l->len        = 0;
+            l->program[0] = duckparser::OP_END;
+        }
+
+        l->in_line = in_line;
+
+        // Publish the line only after it was written completely
+        __sync_synchronize();
+        ++head;
+
+        return true;
+    }
+
+    // ====== PUBLIC ====== //
+    void start() {
+#if !defined(ARDUINO_ARCH_RP2040)
+        lines[0].program = duckparser::getProgram();
+#endif // if !defined(ARDUINO_ARCH_RP2040)
+
+        head    = 0;
+        tail    = 0;
+        done    = false;
+        in_line = false;
+
+        __sync_synchronize();
+        running = true;
+
+        wake();
+    }
+
+    void stop() {
+        running = false;
+
+        __sync_synchronize();
+        while (!idle) {}
+
+        // Lines that were compiled ahead, but not consumed, are read again after start()
+        if (head != tail) {
+            const line_t* l = &lines[tail % PREFETCH_SLOTS];
+
+            msc::gotoPosition(l->pos);
+            duckparser::restore_state(l->state);
+        }
+
+        head = 0;
+        tail = 0;
+    }
+
+    bool update() {
+        bool produced = false;
+
+        idle = false;
+
+        __sync_synchronize();
+        if (running) produced = produce();
+
+        idle = true;
+
+        return produced;
+    }
+
+    const line_t* next() {
+#if !defined(ARDUINO_ARCH_RP2040)
+        // Without a second core, lines are compiled on demand
+        if (head == tail) update();
+#endif // if !defined(ARDUINO_ARCH_RP2040)
+
+        while (head == tail) tasks::update();
+
+        __sync_synchronize();
+        return &lines[tail % PREFETCH_SLOTS];
+    }
+
+    void release() {
+        __sync_synchronize();
+        ++tail;
+
+        // A slot is free again
+        wake();
+    }
+}
\ No newline at end of file
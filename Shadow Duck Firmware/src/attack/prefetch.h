@@ -0,0 +1,43 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+#include "config.h"
+#include "duckparser/compiler.h" // compiler_state_t
+
+namespace prefetch {
+    // A line of the open script (or a chunk of it) that was already compiled
+    typedef struct line_t {
+#if defined(ARDUINO_ARCH_RP2040)
+        uint8_t  program[PROGRAM_SIZE];
+#else // if defined(ARDUINO_ARCH_RP2040)
+        uint8_t* program; // The one of duckparser, nothing is compiled ahead
+#endif // if defined(ARDUINO_ARCH_RP2040)
+        size_t   len;        // Bytes of program without OP_END
+        size_t   text_len;   // Bytes read from the file, 0 at the end of the file
+        uint32_t pos;        // File position of the text
+        uint32_t next_pos;   // File position after the text
+        bool     line_begin; // Text starts a new line
+        bool     in_line;    // Line continues in the next one
+
+        duckparser::compiler_state_t state; // Before compiling, to go back to it in stop()
+    } line_t;
+
+    // Compile ahead from the current position of msc, which must be the start of a line
+    void start();
+
+    // Wait for the producer and go back to the first line that wasn't consumed yet,
+    // so msc can be used (seek, open, ...) until start() is called again
+    void stop();
+
+    // Producer, called in loop1() on RP2040.
+    // Returns false if there is nothing to do until start() or release() is called.
+    bool update();
+
+    // Consumer, waits for the next line. It stays valid until release() is called.
+    const line_t* next();
+    void release();
+}
\ No newline at end of file
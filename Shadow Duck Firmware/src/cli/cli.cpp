@@ -10,9 +10,15 @@
 #include "led/led.h"
 #include "attack/attack.h"
 #include "msc/msc.h"
+#include "msc/cache.h"
+#include "locale/locale.h"
+#include "events/events.h"
+#include "tasks/tasks.h"
 #include "config.h"
 #include "debug.h"
 
+#include <string.h> // strcmp
+
 #define BUFFER_SIZE 1024
 
 namespace cli {
@@ -96,7 +102,7 @@ namespace cli {
         // format
         cli.addCmd("format", [](cmd* c) {
             led::setColor(255, 255, 255);
-            msc::format(preferences::getDriveName().c_str());
+            msc::format(preferences::getDriveName());
             preferences::save();
             if (selector::mode() == SETUP) {
                 led::setColor(preferences::getSetupColor());
@@ -127,6 +133,34 @@ namespace cli {
             msc::print();
         }).setDescription(" Show available files on the drive.");
 
+        // locales
+        cli.addCmd("locales", [](cmd* c) {
+            debuglnF("[ = Keyboard Layouts =]");
+            for (size_t i = 0; i < locale::count(); ++i) {
+                debugln(locale::get_name(i));
+            }
+            debugln();
+        }).setDescription(" List the keyboard layouts for LOCALE and default_layout.");
+
+        // tasks
+        cli.addCmd("tasks", [](cmd* c) {
+            tasks::print();
+        }).setDescription(" Print how often and how long the background tasks ran.");
+
+        // cache
+        cli.addSingleArgCmd("cache", [](cmd* c) {
+            Command  cmd(c);
+            Argument arg = cmd.getArgument(0);
+
+            if (strcmp(arg.getValue().c_str(), "reset") == 0) {
+                cache::resetStats();
+                debuglnF("Flash cache statistics reset");
+                return;
+            }
+
+            cache::print();
+        }).setDescription(" Print hits, misses and write backs of the flash cache, 'cache reset' sets them to zero.");
+
         // run
         cli.addSingleArgCmd("run", [](cmd* c) {
             Command cmd(c);
@@ -155,4 +189,13 @@ namespace cli {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+#if defined(USE_TINYUSB)
+// Invoked by TinyUSB when the serial port received data
+extern "C" void tud_cdc_rx_cb(uint8_t itf) {
+    (void)itf;
+
+    events::post(events::EVENT_SERIAL);
+}
+#endif // if defined(USE_TINYUSB)
\ No newline at end of file
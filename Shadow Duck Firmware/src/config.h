@@ -11,13 +11,37 @@
 
 // ===== Storage Settings ===== //
 #define READ_BUFFER 2048
+#define READ_CACHE 2048 // Read-ahead of the open script (multiple of 512)
+#define FLASH_SYNC_DELAY 500 // ms without writes from the host before they are written to flash
+#define PATH_CACHE 8 // Paths whose directory entry is remembered (see msc/paths.h)
+#define PATH_CACHE_LEN 48 // Bytes per remembered path, including the terminating zero
+
+// Written flash sectors kept in RAM (4 KB each, see msc/cache.h), one of them is the scratch memory for formatting
+#if defined(ARDUINO_ARCH_RP2040)
+    #define FLASH_CACHE_SECTORS 4
+#else // if defined(ARDUINO_ARCH_RP2040)
+    #define FLASH_CACHE_SECTORS 2
+#endif // if defined(ARDUINO_ARCH_RP2040)
 
 // ===== Parser Settings ===== //
 #define CASE_SENSETIVE false
 #define DEFAULT_SLEEP 5
+#define PARSER_ARENA_SIZE 2048 // Bytes for line/word nodes per compile() call, more text is compiled in parts
+#define PROGRAM_SIZE (READ_BUFFER + 256) // Bytes of compiled opcodes per parse() call
+#define REPEAT_CACHE 1024 // Bytes of compiled opcodes of the last line, replayed by REPEAT
+#define LOOP_CACHE 2048  // Bytes of compiled opcodes of a loop body, replayed by LOOP_END
+#if defined(ARDUINO_ARCH_RP2040)
+    #define PREFETCH_SLOTS 4 // Lines that are compiled ahead on core1
+#else // if defined(ARDUINO_ARCH_RP2040)
+    #define PREFETCH_SLOTS 1 // Without a second core, a line is compiled when it's needed
+#endif // if defined(ARDUINO_ARCH_RP2040)
+
+// ===== HID Settings ===== //
+#define HID_QUEUE 32 // Reports that can wait for the next poll of the USB host
 
 // ===== Other Stuff ====== //
 #define PREFERENCES_PATH "preferences.json"
+#define MAX_TASKS 8 // Background tasks (see tasks/tasks.h)
 
 // ===== Pin Definitions ===== //
 
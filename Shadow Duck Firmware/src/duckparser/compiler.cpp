@@ -0,0 +1,516 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#include "duckparser/compiler.h"
+
+#include "config.h"
+#include "locale/locale.h"
+#include "led/led.h"
+
+#include <string.h> // memcpy
+#include <stdlib.h> // atoi
+
+#include "parser.h"   // parse_lines
+#include "keywords.h" // find_command, find_key
+
+#define TU_BIT(n) (1U << (n))
+
+namespace duckparser {
+    // ====== PRIVATE ===== //
+    bool in_string       = false;
+    bool in_stringln     = false;
+    bool in_comment      = false;
+    bool in_ml_comment   = false;
+    bool in_large_string = false;
+    bool in_keys         = false; // Rest of a line of keys that was cut off
+
+    typedef struct writer_t {
+        uint8_t* buf;
+        size_t   size;
+        size_t   pos;
+        bool     full;
+        bool     persistent; // Source text outlives the program
+    } writer_t;
+
+    // Make sure the next op (opcode + operands) fits, one byte is always kept for OP_END
+    bool reserve(writer_t* w, size_t len) {
+        if (!w->full && (w->pos + len + 1 > w->size)) w->full = true;
+        return !w->full;
+    }
+
+    void emit_u8(writer_t* w, uint8_t val) {
+        w->buf[w->pos++] = val;
+    }
+
+    void emit_u16(writer_t* w, uint16_t val) {
+        emit_u8(w, val & 0xFF);
+        emit_u8(w, val >> 8);
+    }
+
+    void emit_u32(writer_t* w, uint32_t val) {
+        for (uint8_t i = 0; i < 4; ++i) emit_u8(w, (val >> (i * 8)) & 0xFF);
+    }
+
+    void emit_bytes(writer_t* w, const void* data, size_t len) {
+        if (len == 0) return;
+        memcpy(&w->buf[w->pos], data, len);
+        w->pos += len;
+    }
+
+    void emit_op(writer_t* w, Opcode op) {
+        if (reserve(w, 1)) emit_u8(w, op);
+    }
+
+    void emit_op_u8(writer_t* w, Opcode op, uint8_t val) {
+        if (!reserve(w, 2)) return;
+        emit_u8(w, op);
+        emit_u8(w, val);
+    }
+
+    void emit_op_u32(writer_t* w, Opcode op, uint32_t val) {
+        if (!reserve(w, 5)) return;
+        emit_u8(w, op);
+        emit_u32(w, val);
+    }
+
+    void emit_op_str(writer_t* w, Opcode op, const char* str, size_t len) {
+        if (len > 0xFFFF) len = 0xFFFF;
+        if (!reserve(w, 3 + len)) return;
+        emit_u8(w, op);
+        emit_u16(w, len);
+        emit_bytes(w, str, len);
+    }
+
+    void emit_string(writer_t* w, const char* str, size_t len) {
+        if (!w->persistent) {
+            emit_op_str(w, OP_STRING, str, len);
+            return;
+        }
+
+        if (!reserve(w, 1 + sizeof(str) + 4)) return;
+        emit_u8(w, OP_STRING_REF);
+        emit_bytes(w, &str, sizeof(str));
+        emit_u32(w, len);
+    }
+
+    int to_int(const char* str, size_t len) {
+        char newstr[len+1];
+
+        memcpy(newstr, (void*)str, len);
+        newstr[len] = '\0';
+
+        return atoi(newstr);
+    }
+
+    unsigned int to_uint(const char* str, size_t len) {
+        if (!str || (len == 0)) return 0;
+
+        unsigned int val = 0;
+
+        // HEX
+        if ((len > 2) && (str[0] == '0') && (str[1] == 'x')) {
+            for (size_t i = 2; i < len; ++i) {
+                uint8_t b = str[i];
+
+                if ((b >= '0') && (b <= '9')) b = b - '0';
+                else if ((b >= 'a') && (b <= 'f')) b = b - 'a' + 10;
+                else if ((b >= 'A') && (b <= 'F')) b = b - 'A' + 10;
+
+                val = (val << 4) | (b & 0xF);
+            }
+        }
+        // DECIMAL
+        else {
+            for (size_t i = 0; i < len; ++i) {
+                if ((str[i] >= '0') && (str[i] <= '9')) {
+                    val = val * 10 + (str[i] - '0');
+                }
+            }
+        }
+
+        return val;
+    }
+
+    void compile_key(writer_t* w, uint8_t key) {
+        emit_op_u8(w, OP_KEY, key);
+    }
+
+    void compile_modifier(writer_t* w, uint8_t modifier) {
+        emit_op_u8(w, OP_MODIFIER, modifier);
+    }
+
+    void compile_char(writer_t* w, const char* str, size_t len) {
+        // A character is at most 4 bytes (longest UTF-8 sequence)
+        if (len > 4) len = 4;
+        if (!reserve(w, 2 + len)) return;
+
+        emit_u8(w, OP_CHAR);
+        emit_u8(w, len);
+        emit_bytes(w, str, len);
+    }
+
+    void compile_press(writer_t* w, const char* str, size_t len) {
+        uint8_t key;
+        uint8_t modifiers;
+
+        // character
+        if (len == 1) compile_char(w, str, len);
+
+        // Keys and modifiers (ENTER, F1, CTRL, ...)
+        else if (find_key(str, len, &key, &modifiers)) {
+            if (key != KEY_NONE) compile_key(w, key);
+            else compile_modifier(w, modifiers);
+        }
+
+        // Utf8 character
+        else compile_char(w, str, len);
+    }
+
+    // ====== PUBLIC ===== //
+    compiler_state_t save_state() {
+        return { in_string, in_stringln, in_comment, in_ml_comment, in_large_string, in_keys };
+    }
+
+    void restore_state(compiler_state_t state) {
+        in_string       = state.in_string;
+        in_stringln     = state.in_stringln;
+        in_comment      = state.in_comment;
+        in_ml_comment   = state.in_ml_comment;
+        in_large_string = state.in_large_string;
+        in_keys         = state.in_keys;
+    }
+
+    size_t compile(const char* str, size_t len, uint8_t* program, size_t size, size_t* consumed, bool persistent) {
+        *consumed = 0;
+
+        if (!program || (size == 0)) return 0;
+
+        writer_t w { program, size, 0, false, persistent };
+
+        // Drop the nodes of the previous call
+        arena_reset();
+
+        // Split str into a list of lines
+        line_list* l = parse_lines(str, len);
+
+        // Go through all lines
+        line_node* n = l ? l->first : nullptr;
+
+        // Flag, no default delay after this command
+        bool ignore_delay;
+
+        // Where the next call has to continue, if the program is full before the end of str
+        const char* cut = nullptr;
+
+        // To drop a line that didn't fit completely
+        size_t line_pos             = 0;
+        compiler_state_t line_state = save_state();
+
+        while (n && !w.full && !cut) {
+            word_list* wl  = n->words;
+            word_node* cmd = wl ? wl->first : nullptr;
+
+            // Line without any words
+            if (!cmd) {
+                n = n->next;
+                continue;
+            }
+
+            // String of the entire line excluding the command keyword (i.e. "STRING ")
+            bool has_line_str    = cmd->next;
+            const char* line_str = has_line_str ? (cmd->str + cmd->len + 1) : nullptr;
+            size_t line_str_len  = has_line_str ? (n->len - cmd->len - 1) : 0;
+
+            char last_char = n->str[n->len];
+            bool line_end  = last_char == '\r' || last_char == '\n';
+
+            // The rest of a line that was cut into chunks doesn't start with a command
+            bool continued  = in_string || in_stringln || in_keys;
+            Command command = continued ? CMD_NONE : find_command(cmd->str, cmd->len);
+
+            ignore_delay = false;
+            line_pos     = w.pos;
+            line_state   = save_state();
+
+            // Check if we're in a multi line comment
+            if (in_ml_comment) {
+                // Check for the end of the comment block
+                if (command == CMD_ML_COMMENT) {
+                    in_ml_comment = false;
+                }
+                ignore_delay = true;
+            }
+            // Check if we're in a large string
+            else if (in_large_string) {
+                // Stop it
+                if (command == CMD_LSTRING_END) {
+                    in_large_string = false;
+                    ignore_delay    = true;
+                }
+                // or type out the entire line
+                else {
+                    emit_string(&w, n->str, n->len);
+                    if (line_end) emit_op(&w, OP_ENTER);
+                }
+            }
+            // LSTRING_BEGIN (-> type each character including linebreaks until LSTRING_END)
+            else if (command == CMD_LSTRING_BEGIN) {
+                in_large_string = true;
+                ignore_delay    = true;
+            }
+            // REM or # (= Comment -> do nothing)
+            else if (in_comment || command == CMD_REM) {
+                in_comment   = !line_end;
+                ignore_delay = true;
+            }
+            // ### (= multiline comment -> do nothing)
+            else if (command == CMD_ML_COMMENT) {
+                in_ml_comment = true;
+                ignore_delay  = true;
+            }
+            // DEFAULTDELAY/DEFAULT_DELAY (set default delay per command)
+            else if (command == CMD_DEFAULT_DELAY) {
+                emit_op_u32(&w, OP_DEFAULT_DELAY, to_uint(line_str, line_str_len));
+                ignore_delay = true;
+            }
+            // DELAY (-> sleep for x ms)
+            else if (command == CMD_DELAY) {
+                emit_op_u32(&w, OP_DELAY, to_uint(line_str, line_str_len));
+                ignore_delay = true;
+            }
+            // STRING (-> type each character)
+            else if (in_string || command == CMD_STRING) {
+                // Type the entire line
+                if (in_string) {
+                    emit_string(&w, n->str, n->len);
+                }
+                // Type the everything after "STRING "
+                else {
+                    emit_string(&w, line_str, line_str_len);
+                }
+
+                in_string = !line_end;
+            }
+            // STRINGLN (-> type each character & press enter)
+            else if (in_stringln || command == CMD_STRINGLN) {
+                // Type the entire line
+                if (in_stringln) {
+                    emit_string(&w, n->str, n->len);
+                }
+                // Type the everything after "STRINGLN "
+                else {
+                    emit_string(&w, line_str, line_str_len);
+                }
+
+                if (line_end) emit_op(&w, OP_ENTER);
+
+                in_stringln = !line_end;
+            }
+            // REPEAT (-> repeat last command n times)
+            else if (command == CMD_REPEAT) {
+                emit_op_u32(&w, OP_REPEAT, to_uint(line_str, line_str_len));
+                ignore_delay = true;
+            }
+            // LOOP_BEGIN
+            else if (command == CMD_LOOP_BEGIN) {
+                emit_op_u32(&w, OP_LOOP_BEGIN, to_uint(line_str, line_str_len));
+                ignore_delay = true;
+            }
+            // LOOP_END
+            else if (command == CMD_LOOP_END) {
+                emit_op(&w, OP_LOOP_END);
+                ignore_delay = true;
+            }
+            // LOCALE (-> change keyboard layout)
+            else if (command == CMD_LOCALE) {
+                word_node* wn        = cmd->next;
+                const hid_locale_t* layout = wn ? locale::get(wn->str, wn->len) : nullptr;
+
+                // An unknown layout is still emitted (as nullptr), so running it can tell
+                if (reserve(&w, 1 + sizeof(layout))) {
+                    emit_u8(&w, OP_LOCALE);
+                    emit_bytes(&w, &layout, sizeof(layout));
+                }
+
+                ignore_delay = true;
+            }
+            // LED
+            else if (command == CMD_LED) {
+                // i.e. LED R SOLID
+                if (wl->size == 3) {
+                    word_node* wn = cmd->next;
+                    led::Color color;
+                    led::Mode  mode;
+
+                    if (compare(wn->str, wn->len, "R", CASE_SENSETIVE)) {
+                        color = led::Color::RED;
+                    } else if (compare(wn->str, wn->len, "G", CASE_SENSETIVE)) {
+                        color = led::Color::GREEN;
+                    } else { /* if (compare(wn->str, wn->len, "B", CASE_SENSETIVE)) */
+                        color = led::Color::BLUE;
+                    }
+
+                    wn = wn->next;
+
+                    if (compare(wn->str, wn->len, "SOLID", CASE_SENSETIVE)) {
+                        mode = led::Mode::SOLID;
+                    } else if (compare(wn->str, wn->len, "SLOW", CASE_SENSETIVE)) {
+                        mode = led::Mode::SLOW;
+                    } else if (compare(wn->str, wn->len, "FAST", CASE_SENSETIVE)) {
+                        mode = led::Mode::FAST;
+                    } else { /* if (compare(wn->str, wn->len, "OFF", CASE_SENSETIVE)) */
+                        mode = led::Mode::OFF;
+                    }
+
+                    if (reserve(&w, 3)) {
+                        emit_u8(&w, OP_LED_MODE);
+                        emit_u8(&w, color);
+                        emit_u8(&w, mode);
+                    }
+                }
+                // i.e. LED 128 23 42 0 (r,g,b, blink)
+                else {
+                    word_node* wn = cmd->next;
+
+                    unsigned int c[4];
+
+                    for (uint8_t i = 0; i<4; ++i) {
+                        if (wn) {
+                            c[i] = to_uint(wn->str, wn->len);
+                            wn   = wn->next;
+                        } else {
+                            c[i] = 0;
+                        }
+                    }
+
+                    if (reserve(&w, 8)) {
+                        emit_u8(&w, OP_LED_COLOR);
+                        emit_u8(&w, c[0]);
+                        emit_u8(&w, c[1]);
+                        emit_u8(&w, c[2]);
+                        emit_u32(&w, c[3]);
+                    }
+                }
+
+                ignore_delay = true;
+            }
+            // KEYCODE
+            else if (command == CMD_KEYCODE) {
+                word_node* wn = cmd->next;
+                if (wn && reserve(&w, 8)) {
+                    emit_u8(&w, OP_KEYCODE);
+                    emit_u8(&w, (uint8_t)to_uint(wn->str, wn->len));
+                    wn = wn->next;
+
+                    for (uint8_t i = 0; i<6; ++i) {
+                        if (wn) {
+                            emit_u8(&w, (uint8_t)to_uint(wn->str, wn->len));
+                            wn = wn->next;
+                        } else {
+                            emit_u8(&w, 0);
+                        }
+                    }
+                }
+            }
+            // MOUSE x y, MOVE x y
+            else if (command == CMD_MOUSE) {
+                word_node* wn = cmd->next;
+                int x         = wn ? to_int(wn->str, wn->len) : 0;
+                wn = wn ? wn->next : nullptr;
+                int y = wn ? to_int(wn->str, wn->len) : 0;
+
+                if (reserve(&w, 3)) {
+                    emit_u8(&w, OP_MOUSE_MOVE);
+                    emit_u8(&w, (int8_t)x);
+                    emit_u8(&w, (int8_t)y);
+                }
+            }
+            // MOUSE_CLICK button, CLICK button
+            else if (command == CMD_MOUSE_CLICK) {
+                word_node* wn = cmd->next;
+                emit_op_u8(&w, OP_MOUSE_CLICK, TU_BIT(wn ? to_uint(wn->str, wn->len) : 0));
+            }
+            // MOUSE_PRESS button, PRESS button
+            else if (command == CMD_MOUSE_PRESS) {
+                word_node* wn = cmd->next;
+                emit_op_u8(&w, OP_MOUSE_PRESS, TU_BIT(wn ? to_uint(wn->str, wn->len) : 0));
+            }
+            // MOUSE_RELEASE button, RELEASE button
+            else if (command == CMD_MOUSE_RELEASE) {
+                word_node* wn = cmd->next;
+                emit_op_u8(&w, OP_MOUSE_RELEASE, TU_BIT(wn ? to_uint(wn->str, wn->len) : 0));
+            }
+            // MOUSE_SCROLL v h, SCROLL v h
+            else if (command == CMD_MOUSE_SCROLL) {
+                word_node* wn = cmd->next;
+                int vertical  = wn ? to_int(wn->str, wn->len) : 0;
+                wn = wn ? wn->next : nullptr;
+                int horizontal = wn ? to_int(wn->str, wn->len) : 0;
+
+                if (reserve(&w, 3)) {
+                    emit_u8(&w, OP_MOUSE_SCROLL);
+                    emit_u8(&w, (int8_t)vertical);
+                    emit_u8(&w, (int8_t)horizontal);
+                }
+            }
+            // IMPORT (-> open another script)
+            else if (command == CMD_IMPORT) {
+                emit_op_str(&w, OP_IMPORT, line_str, line_str_len);
+            }
+            // Otherwise go through words and look for keys to press
+            else {
+                word_node* wn = wl->first;
+
+                // Room for OP_RELEASE and OP_LINE_END is kept, so the line can be cut between two keys
+                w.size -= 3;
+
+                while (wn && !w.full) {
+                    compile_press(&w, wn->str, wn->len);
+                    if (!w.full) wn = wn->next;
+                }
+
+                w.size += 3;
+
+                // The remaining keys (that didn't fit into the program or the arena) are pressed by the next call
+                if (w.full && (wn != wl->first)) {
+                    w.full = false;
+                    cut    = wn->str;
+                } else if (!w.full) {
+                    cut = wl->rest;
+                }
+
+                if (cut) line_end = false;
+
+                in_keys = !line_end;
+
+                if (line_end) emit_op(&w, OP_RELEASE);
+            }
+
+            uint8_t flags = 0;
+
+            if (!in_string && !in_stringln && !in_keys && !in_comment && !in_ml_comment && !ignore_delay) flags |= LINE_FLAG_DELAY;
+            if (line_end) flags |= LINE_FLAG_END;
+
+            emit_op_u8(&w, OP_LINE_END, flags);
+
+            if (!w.full) n = n->next;
+        }
+
+        // The line that didn't fit is compiled again by the next call
+        if (w.full) {
+            w.pos = line_pos;
+            restore_state(line_state);
+            cut = n->str;
+        }
+        // As are the lines that didn't fit into the arena
+        else if (!cut) {
+            cut = l ? l->rest : str;
+        }
+
+        *consumed = cut ? cut - str : len;
+
+        // There is always room for the final OP_END
+        program[w.pos++] = OP_END;
+
+        return w.pos;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+// Flags of OP_LINE_END
+#define LINE_FLAG_DELAY 0x01 // Sleep for the default delay after this line
+#define LINE_FLAG_END   0x02 // Line was terminated by a linebreak (not only a chunk of it)
+
+namespace duckparser {
+    // Compiled representation of a script.
+    // Operands directly follow their opcode byte, multi-byte values are little endian.
+    // Ops are self-contained (strings are stored inline), so a program doesn't
+    // depend on the buffer it was compiled from. The exception is OP_STRING_REF,
+    // which is only used when the text is known to stay in place (see compile()).
+    enum Opcode : uint8_t {
+        OP_END = 0,       // End of program
+        OP_LINE_END,      // u8 flags
+        OP_STRING,        // u16 len, char[len]
+        OP_ENTER,         // Press and release enter
+        OP_KEY,           // u8 key
+        OP_MODIFIER,      // u8 modifier
+        OP_CHAR,          // u8 len (1-4), char[len] (ASCII or UTF-8)
+        OP_RELEASE,       // Release all keys
+        OP_KEYCODE,       // u8 modifiers, u8 keys[6]
+        OP_DELAY,         // u32 ms
+        OP_DEFAULT_DELAY, // u32 ms
+        OP_REPEAT,        // u32 n
+        OP_LOOP_BEGIN,    // u32 n
+        OP_LOOP_END,      // -
+        OP_LOCALE,        // hid_locale_t*, nullptr if the layout isn't built in
+        OP_LED_MODE,      // u8 color, u8 mode
+        OP_LED_COLOR,     // u8 r, u8 g, u8 b, u32 blink interval
+        OP_MOUSE_MOVE,    // i8 x, i8 y
+        OP_MOUSE_CLICK,   // u8 buttons
+        OP_MOUSE_PRESS,   // u8 buttons
+        OP_MOUSE_RELEASE, // u8 buttons
+        OP_MOUSE_SCROLL,  // i8 vertical, i8 horizontal
+        OP_IMPORT,        // u16 len, char[len]
+        OP_STRING_REF,    // const char*, u32 len
+    };
+
+    // Multi-line state of the compiler, so lines that were compiled ahead can be compiled again
+    typedef struct compiler_state_t {
+        bool in_string;
+        bool in_stringln;
+        bool in_comment;
+        bool in_ml_comment;
+        bool in_large_string;
+        bool in_keys;
+    } compiler_state_t;
+
+    compiler_state_t save_state();
+    void restore_state(compiler_state_t state);
+
+    // Translates script text into opcodes, always terminated with OP_END.
+    // State of multi-line constructs (comments, LSTRING, ...) is kept between calls.
+    // If str stays valid while the program runs (i.e. memory mapped flash), strings are
+    // referenced instead of copied, so their length isn't limited by the program size.
+    // If the program or the parser arena is full, str is cut before the line (or key) that didn't fit.
+    // consumed is set to the bytes of str that were compiled, the caller continues from there.
+    // Returns the number of bytes written to program.
+    size_t compile(const char* str, size_t len, uint8_t* program, size_t size, size_t* consumed, bool persistent = false);
+}
\ No newline at end of file
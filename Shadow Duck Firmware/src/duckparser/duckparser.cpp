@@ -4,25 +4,22 @@
 
 #include "config.h"
 #include "debug.h"
+#include "hid/hid.h"
 #include "hid/keyboard.h"
 #include "hid/mouse.h"
 #include "led/led.h"
+#include "locale/utf8.h"
 #include "tasks/tasks.h"
 
 #include <Arduino.h> // millis(), delay()
 
-#include "parser.h"  // parse_lines
-
-#define TU_BIT(n) (1U << (n))
+#include "parser.h"   // arena_high_water
+#include "compiler.h" // compile, Opcode
 
 namespace duckparser {
     // ====== PRIVATE ===== //
-    bool in_string       = false;
-    bool in_comment      = false;
-    bool in_ml_comment   = false;
-    bool in_large_string = false;
-    bool loop_begin      = false;
-    bool loop_end        = false;
+    bool loop_begin = false;
+    bool loop_end   = false;
 
     int default_delay = 5;
     int repeat_num    = 0;
@@ -34,127 +31,84 @@ namespace duckparser {
     unsigned long sleep_start_time    = 0;
     unsigned long sleep_time          = 0;
 
-    void type(const char* str, size_t len) {
-        for (size_t i = 0; i<len; ++i) {
-            i += keyboard::write(&str[i]);
-            if (i%10==0) tasks::update();
-        }
-    }
+    // Characters of STRING ops, a character may be split between two ops if a line was parsed in chunks
+    utf8::decoder_t decoder = { 0, 0, 0 };
+    size_t typed = 0; // Characters typed, to run tasks in between
 
-    void press(const char* str, size_t len) {
-        // character
-        if (len == 1) keyboard::press(str);
-
-        // Keys
-        else if (compare(str, len, "ENTER", CASE_SENSETIVE)) keyboard::pressKey(KEY_ENTER);
-        else if (compare(str, len, "MENU", CASE_SENSETIVE) || compare(str, len, "APP", CASE_SENSETIVE)) keyboard::pressKey(KEY_PROPS);
-        else if (compare(str, len, "DELETE", CASE_SENSETIVE)) keyboard::pressKey(KEY_DELETE);
-        else if (compare(str, len, "BACKSPACE", CASE_SENSETIVE)) keyboard::pressKey(KEY_BACKSPACE);
-        else if (compare(str, len, "HOME", CASE_SENSETIVE)) keyboard::pressKey(KEY_HOME);
-        else if (compare(str, len, "INSERT", CASE_SENSETIVE)) keyboard::pressKey(KEY_INSERT);
-        else if (compare(str, len, "PAGEUP", CASE_SENSETIVE)) keyboard::pressKey(KEY_PAGEUP);
-        else if (compare(str, len, "PAGEDOWN", CASE_SENSETIVE)) keyboard::pressKey(KEY_PAGEDOWN);
-        else if (compare(str, len, "UPARROW", CASE_SENSETIVE) || compare(str, len, "UP", CASE_SENSETIVE)) keyboard::pressKey(KEY_UP);
-        else if (compare(str, len, "DOWNARROW", CASE_SENSETIVE) || compare(str, len, "DOWN", CASE_SENSETIVE)) keyboard::pressKey(KEY_DOWN);
-        else if (compare(str, len, "LEFTARROW", CASE_SENSETIVE) || compare(str, len, "LEFT", CASE_SENSETIVE)) keyboard::pressKey(KEY_LEFT);
-        else if (compare(str, len, "RIGHTARROW", CASE_SENSETIVE) || compare(str, len, "RIGHT", CASE_SENSETIVE)) keyboard::pressKey(KEY_RIGHT);
-        else if (compare(str, len, "TAB", CASE_SENSETIVE)) keyboard::pressKey(KEY_TAB);
-        else if (compare(str, len, "END", CASE_SENSETIVE)) keyboard::pressKey(KEY_END);
-        else if (compare(str, len, "ESC", CASE_SENSETIVE) || compare(str, len, "ESCAPE", CASE_SENSETIVE)) keyboard::pressKey(KEY_ESC);
-        else if (compare(str, len, "SPACE", CASE_SENSETIVE)) keyboard::pressKey(KEY_SPACE);
-        else if (compare(str, len, "PAUSE", CASE_SENSETIVE) || compare(str, len, "BREAK", CASE_SENSETIVE)) keyboard::pressKey(KEY_PAUSE);
-        else if (compare(str, len, "CAPSLOCK", CASE_SENSETIVE)) keyboard::pressKey(KEY_CAPSLOCK);
-        else if (compare(str, len, "NUMLOCK", CASE_SENSETIVE)) keyboard::pressKey(KEY_NUMLOCK);
-        else if (compare(str, len, "PRINTSCREEN", CASE_SENSETIVE)) keyboard::pressKey(KEY_SYSRQ);
-        else if (compare(str, len, "SCROLLLOCK", CASE_SENSETIVE)) keyboard::pressKey(KEY_SCROLLLOCK);
-
-        // Function Keys
-        else if (compare(str, len, "F1", CASE_SENSETIVE)) keyboard::pressKey(KEY_F1);
-        else if (compare(str, len, "F2", CASE_SENSETIVE)) keyboard::pressKey(KEY_F2);
-        else if (compare(str, len, "F3", CASE_SENSETIVE)) keyboard::pressKey(KEY_F3);
-        else if (compare(str, len, "F4", CASE_SENSETIVE)) keyboard::pressKey(KEY_F4);
-        else if (compare(str, len, "F5", CASE_SENSETIVE)) keyboard::pressKey(KEY_F5);
-        else if (compare(str, len, "F6", CASE_SENSETIVE)) keyboard::pressKey(KEY_F6);
-        else if (compare(str, len, "F7", CASE_SENSETIVE)) keyboard::pressKey(KEY_F7);
-        else if (compare(str, len, "F8", CASE_SENSETIVE)) keyboard::pressKey(KEY_F8);
-        else if (compare(str, len, "F9", CASE_SENSETIVE)) keyboard::pressKey(KEY_F9);
-        else if (compare(str, len, "F10", CASE_SENSETIVE)) keyboard::pressKey(KEY_F10);
-        else if (compare(str, len, "F11", CASE_SENSETIVE)) keyboard::pressKey(KEY_F11);
-        else if (compare(str, len, "F12", CASE_SENSETIVE)) keyboard::pressKey(KEY_F12);
-
-        // NUMPAD KEYS
-        else if (compare(str, len, "NUM_0", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP0);
-        else if (compare(str, len, "NUM_1", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP1);
-        else if (compare(str, len, "NUM_2", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP2);
-        else if (compare(str, len, "NUM_3", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP3);
-        else if (compare(str, len, "NUM_4", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP4);
-        else if (compare(str, len, "NUM_5", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP5);
-        else if (compare(str, len, "NUM_6", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP6);
-        else if (compare(str, len, "NUM_7", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP7);
-        else if (compare(str, len, "NUM_8", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP8);
-        else if (compare(str, len, "NUM_9", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP9);
-        else if (compare(str, len, "NUM_ASTERIX", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPASTERISK);
-        else if (compare(str, len, "NUM_ENTER", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPENTER);
-        else if (compare(str, len, "NUM_MINUS", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPMINUS);
-        else if (compare(str, len, "NUM_DOT", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPDOT);
-        else if (compare(str, len, "NUM_PLUS", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPPLUS);
-
-        // Modifiers
-        else if (compare(str, len, "CTRL", CASE_SENSETIVE) || compare(str, len, "CONTROL", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_LCTRL);
-        else if (compare(str, len, "SHIFT", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_LSHIFT);
-        else if (compare(str, len, "ALT", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_LALT);
-        else if (compare(str, len, "ALTGR", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_RALT);
-        else if (compare(str, len, "WINDOWS", CASE_SENSETIVE) || compare(str, len, "GUI", CASE_SENSETIVE) || compare(str, len, "COMMAND", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_LMETA);
-
-        // Numpad Keys
-
-        // Utf8 character
-        else keyboard::press(str);
-    }
+    // Compiled form of the text passed to parse()
+    uint8_t program[PROGRAM_SIZE];
 
-    void release() {
-        keyboard::release();
+    // Compiled lines kept in RAM, so REPEAT and LOOP_END don't have to read them from flash again.
+    // Holds the ops of one or more programs (without their OP_END), terminated by one OP_END.
+    typedef struct cache_t {
+        uint8_t* buf;
+        size_t   size;
+        size_t   len;   // Without OP_END
+        bool     valid; // False if it didn't fit into the budget
+    } cache_t;
+
+    uint8_t line_buf[2][REPEAT_CACHE];
+    uint8_t loop_buf[LOOP_CACHE];
+
+    cache_t line_cache { line_buf[0], REPEAT_CACHE, 0, false }; // Last complete line
+    cache_t next_cache { line_buf[1], REPEAT_CACHE, 0, false }; // Line that is running
+    cache_t loop_cache { loop_buf, LOOP_CACHE, 0, false };
+
+    bool next_done = true;  // next_cache holds a complete line
+    bool recording = false; // loop_cache is being recorded
+
+    void cache_clear(cache_t* c) {
+        c->buf[0] = OP_END;
+        c->len    = 0;
+        c->valid  = true;
     }
 
-    int to_int(const char* str, size_t len) {
-        char newstr[len+1];
+    void cache_append(cache_t* c, const uint8_t* ops, size_t len) {
+        if (!c->valid) return;
 
-        memcpy(newstr, (void*)str, len);
-        newstr[len+1] = '\0';
+        // One byte is kept for OP_END
+        if (c->len + len + 1 > c->size) {
+            c->valid = false;
+            return;
+        }
 
-        return atoi(newstr);
+        memcpy(&c->buf[c->len], ops, len);
+        c->len         += len;
+        c->buf[c->len]  = OP_END;
     }
 
-    unsigned int to_uint(const char* str, size_t len) {
-        if (!str || (len == 0)) return 0;
+    void type(const char* str, size_t len) {
+        if (len == 0) return;
 
-        unsigned int val = 0;
+        for (size_t i = 0; i < len; ++i) {
+            uint32_t code;
 
-        // HEX
-        if ((len > 2) && (str[0] == '0') && (str[1] == 'x')) {
-            for (size_t i = 2; i < len; ++i) {
-                uint8_t b = str[i];
+            if (!utf8::feed(&decoder, str[i], &code)) continue;
 
-                if ((b >= '0') && (b <= '9')) b = b - '0';
-                else if ((b >= 'a') && (b <= 'f')) b = b - 'a' + 10;
-                else if ((b >= 'A') && (b <= 'F')) b = b - 'A' + 10;
+            keyboard::type(code);
 
-                val = (val << 4) | (b & 0xF);
-            }
-        }
-        // DECIMAL
-        else {
-            for (size_t i = 0; i < len; ++i) {
-                if ((str[i] >= '0') && (str[i] <= '9')) {
-                    val = val * 10 + (str[i] - '0');
-                }
-            }
+            if (++typed % 10 == 0) tasks::update();
         }
 
-        return val;
+        keyboard::release();
+    }
+
+    void press(const char* str, size_t len) {
+        uint32_t code;
+
+        if (utf8::decode(str, len, &code) > 0) keyboard::press(code);
+    }
+
+    void release() {
+        keyboard::release();
     }
 
     void sleep(unsigned long time) {
+        if (time == 0) return;
+
+        // Start sleeping once the typed keys were actually sent
+        hid::flush();
+
         // Account for the time lost during interpretation
         unsigned long offset = (millis() - interpret_timestamp);
 
@@ -174,280 +128,320 @@ namespace duckparser {
         }
     }
 
-    // ====== PUBLIC ===== //
+    uint16_t read_u16(const uint8_t*& pc) {
+        uint16_t val = pc[0] | (pc[1] << 8);
 
-    void setDefaultDelay(int defaultDelay) {
-        default_delay = defaultDelay;
+        pc += 2;
+        return val;
     }
 
-    void parse(const char* str, size_t len) {
-        interpret_timestamp = millis();
-        led::update();
+    uint32_t read_u32(const uint8_t*& pc) {
+        uint32_t val = pc[0] | (pc[1] << 8) | (pc[2] << 16) | ((uint32_t)pc[3] << 24);
 
-        // Split str into a list of lines
-        line_list* l = parse_lines(str, len);
+        pc += 4;
+        return val;
+    }
 
-        // Go through all lines
-        line_node* n = l->first;
+    void execute(const uint8_t* pc) {
+        // Flag, start of a new line
+        bool line_begin = true;
 
-        // Flag, no default delay after this command
-        bool ignore_delay;
+        while (true) {
+            uint8_t op = *pc++;
 
-        while (n) {
-            word_list* wl  = n->words;
-            word_node* cmd = wl->first;
+            if (op == OP_END) return;
 
-            // String of the entire line excluding the command keyword (i.e. "STRING ")
-            bool has_line_str    = cmd->next;
-            const char* line_str = has_line_str ? (cmd->str + cmd->len + 1) : nullptr;
-            size_t line_str_len  = has_line_str ? (n->len - cmd->len - 1) : 0;
+            if (line_begin) {
+                loop_begin = false;
+                loop_end   = false;
+                line_begin = false;
+            }
 
-            char last_char = n->str[n->len];
-            bool line_end  = last_char == '\r' || last_char == '\n';
+            switch (op) {
+                case OP_LINE_END: {
+                    uint8_t flags = *pc++;
 
-            ignore_delay = false;
-            loop_begin   = false;
-            loop_end     = false;
+                    if (flags & LINE_FLAG_DELAY) sleep(default_delay);
+                    if ((flags & LINE_FLAG_END) && (repeat_num > 0)) --repeat_num;
 
-            // Check if we're in a multi line comment
-            if (in_ml_comment) {
-                // Check for the end of the comment block
-                if (compare(cmd->str, cmd->len, "###", CASE_SENSETIVE)) {
-                    in_ml_comment = false;
-                }
-                ignore_delay = true;
-            }
-            // Check if we're in a large string
-            else if (in_large_string) {
-                // Stop it
-                if (compare(cmd->str, cmd->len, "LSTRING_END", CASE_SENSETIVE)) {
-                    in_large_string = false;
-                    ignore_delay    = true;
-                }
-                // or type out the entire line
-                else {
-                    type(n->str, n->len);
-                    if (line_end) {
-                        keyboard::pressKey(KEY_ENTER);
-                        release();
-                    }
-                }
-            }
-            // LSTRING_BEGIN (-> type each character including linebreaks until LSTRING_END)
-            else if (compare(cmd->str, cmd->len, "LSTRING_BEGIN", CASE_SENSETIVE)) {
-                in_large_string = true;
-                ignore_delay    = true;
-            }
-            // REM or # (= Comment -> do nothing)
-            else if (in_comment || compare(cmd->str, cmd->len, "REM", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "#", CASE_SENSETIVE)) {
-                in_comment   = !line_end;
-                ignore_delay = true;
-            }
-            // ### (= multiline comment -> do nothing)
-            else if (compare(cmd->str, cmd->len, "###", CASE_SENSETIVE)) {
-                in_ml_comment = true;
-                ignore_delay  = true;
-            }
-            // DEFAULTDELAY/DEFAULT_DELAY (set default delay per command)
-            else if (compare(cmd->str, cmd->len, "DEFAULTDELAY", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "DEFAULT_DELAY", CASE_SENSETIVE)) {
-                default_delay = to_uint(line_str, line_str_len);
-                ignore_delay  = true;
-            }
-            // DELAY (-> sleep for x ms)
-            else if (compare(cmd->str, cmd->len, "DELAY", CASE_SENSETIVE)) {
-                sleep(to_uint(line_str, line_str_len));
-                ignore_delay = true;
-            }
-            // STRING (-> type each character)
-            else if (in_string || compare(cmd->str, cmd->len, "STRING", CASE_SENSETIVE)) {
-                // Type the entire line
-                if (in_string) {
-                    type(n->str, n->len);
-                }
-                // Type the everything after "STRING "
-                else {
-                    type(line_str, line_str_len);
+                    interpret_timestamp = millis();
+                    tasks::update();
+
+                    line_begin = true;
+                    break;
                 }
 
-                in_string = !line_end;
-            }
-            // STRINGLN (-> type each character & press enter)
-            else if (in_string || compare(cmd->str, cmd->len, "STRINGLN", CASE_SENSETIVE)) {
-                // Type the entire line
-                if (in_string) {
-                    type(n->str, n->len);
+                case OP_STRING: {
+                    uint16_t len = read_u16(pc);
+
+                    type((const char*)pc, len);
+                    pc += len;
+                    break;
                 }
-                // Type the everything after "STRINGLN "
-                else {
-                    type(line_str, line_str_len);
+
+                case OP_STRING_REF: {
+                    const char* str;
+
+                    memcpy(&str, pc, sizeof(str));
+                    pc += sizeof(str);
+
+                    type(str, read_u32(pc));
+                    break;
                 }
 
-                if (line_end) {
+                case OP_ENTER:
                     keyboard::pressKey(KEY_ENTER);
                     release();
+                    break;
+
+                case OP_KEY:
+                    keyboard::pressKey(*pc++);
+                    break;
+
+                case OP_MODIFIER:
+                    keyboard::pressModifier(*pc++);
+                    break;
+
+                case OP_CHAR: {
+                    uint8_t len = *pc++;
+
+                    press((const char*)pc, len);
+                    pc += len;
+                    break;
                 }
 
-                in_string = !line_end;
-            }
-            // REPEAT (-> repeat last command n times)
-            else if (compare(cmd->str, cmd->len, "REPEAT", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "REPLAY", CASE_SENSETIVE)) {
-                repeat_num   = to_uint(line_str, line_str_len) + 1;
-                ignore_delay = true;
-            }
-            // LOOP_BEGIN
-            else if (compare(cmd->str, cmd->len, "LOOP_BEGIN", CASE_SENSETIVE)) {
-                loop_num     = to_uint(line_str, line_str_len);
-                loop_begin   = true;
-                ignore_delay = true;
-            }
-            // LOOP_END
-            else if (compare(cmd->str, cmd->len, "LOOP_END", CASE_SENSETIVE)) {
-                loop_end     = true;
-                ignore_delay = true;
-            }
-            // LOCALE (-> change keyboard layout)
-            else if (compare(cmd->str, cmd->len, "LOCALE", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
+                case OP_RELEASE:
+                    release();
+                    break;
 
-                keyboard::setLocale(locale::get(w->str));
+                case OP_KEYCODE: {
+                    keyboard::report_t k;
 
-                ignore_delay = true;
-            }
-            // LED
-            else if (compare(cmd->str, cmd->len, "LED", CASE_SENSETIVE)) {
-                // i.e. LED R SOLID
-                if (wl->size == 3) {
-                    word_node* w = cmd->next;
-                    led::Color color;
-                    led::Mode  mode;
-
-                    if (compare(w->str, w->len, "R", CASE_SENSETIVE)) {
-                        color = led::Color::RED;
-                    } else if (compare(w->str, w->len, "G", CASE_SENSETIVE)) {
-                        color = led::Color::GREEN;
-                    } else { /* if (compare(w->str, w->len, "B", CASE_SENSETIVE)) */
-                        color = led::Color::BLUE;
-                    }
-
-                    w = w->next;
-
-                    if (compare(w->str, w->len, "SOLID", CASE_SENSETIVE)) {
-                        mode = led::Mode::SOLID;
-                    } else if (compare(w->str, w->len, "SLOW", CASE_SENSETIVE)) {
-                        mode = led::Mode::SLOW;
-                    } else if (compare(w->str, w->len, "FAST", CASE_SENSETIVE)) {
-                        mode = led::Mode::FAST;
-                    } else { /* if (compare(w->str, w->len, "OFF", CASE_SENSETIVE)) */
-                        mode = led::Mode::OFF;
-                    }
+                    k.modifiers = *pc++;
+                    memcpy(k.keys, pc, 6);
+                    pc += 6;
+
+                    keyboard::send(&k);
+                    keyboard::release();
+                    break;
+                }
+
+                case OP_DELAY:
+                    sleep(read_u32(pc));
+                    break;
+
+                case OP_DEFAULT_DELAY:
+                    default_delay = read_u32(pc);
+                    break;
+
+                case OP_REPEAT:
+                    repeat_num = read_u32(pc) + 1;
+                    break;
+
+                case OP_LOOP_BEGIN:
+                    loop_num   = read_u32(pc);
+                    loop_begin = true;
+                    break;
+
+                case OP_LOOP_END:
+                    loop_end = true;
+                    break;
+
+                case OP_LOCALE: {
+                    const hid_locale_t* layout;
+
+                    memcpy(&layout, pc, sizeof(layout));
+                    pc += sizeof(layout);
+
+                    if (!keyboard::setLocale(layout)) debugln("Keyboard layout isn't built in, LOCALE ignored");
+                    break;
+                }
+
+                case OP_LED_MODE: {
+                    led::Color color = (led::Color)*pc++;
+                    led::Mode  mode  = (led::Mode)*pc++;
 
                     led::setMode(color, mode);
+                    break;
                 }
-                // i.e. LED 128 23 42 0 (r,g,b, blink)
-                else {
-                    word_node* w = cmd->next;
-
-                    int c[4];
-
-                    for (uint8_t i = 0; i<4; ++i) {
-                        if (w) {
-                            c[i] = to_uint(w->str, w->len);
-                            w    = w->next;
-                        } else {
-                            c[i] = 0;
-                        }
-                    }
-
-                    led::setColor(c[0], c[1], c[2], c[3]);
+
+                case OP_LED_COLOR: {
+                    uint8_t r = *pc++;
+                    uint8_t g = *pc++;
+                    uint8_t b = *pc++;
+
+                    led::setColor(r, g, b, read_u32(pc));
+                    break;
                 }
 
-                ignore_delay = true;
-            }
-            // KEYCODE
-            else if (compare(cmd->str, cmd->len, "KEYCODE", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
-                if (w) {
-                    keyboard::report_t k;
+                case OP_MOUSE_MOVE: {
+                    int8_t x = (int8_t)*pc++;
+                    int8_t y = (int8_t)*pc++;
 
-                    k.modifiers = (uint8_t)to_uint(w->str, w->len);
-                    w           = w->next;
+                    mouse::move(x, y);
+                    break;
+                }
 
-                    for (uint8_t i = 0; i<6; ++i) {
-                        if (w) {
-                            k.keys[i] = (uint8_t)to_uint(w->str, w->len);
-                            w         = w->next;
-                        } else {
-                            k.keys[i] = 0;
-                        }
-                    }
+                case OP_MOUSE_CLICK:
+                    mouse::click(*pc++);
+                    break;
 
-                    keyboard::send(&k);
-                    keyboard::release();
+                case OP_MOUSE_PRESS:
+                    mouse::press(*pc++);
+                    break;
+
+                case OP_MOUSE_RELEASE:
+                    mouse::release(*pc++);
+                    break;
+
+                case OP_MOUSE_SCROLL: {
+                    int8_t vertical   = (int8_t)*pc++;
+                    int8_t horizontal = (int8_t)*pc++;
+
+                    mouse::scroll(vertical, horizontal);
+                    break;
                 }
-            }
-            // MOUSE x y, MOVE x y
-            else if (compare(cmd->str, cmd->len, "MOUSE", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "MOVE", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
-                int x        = w ? to_int(w->str, w->len) : 0;
-                w = w->next;
-                int y = w ? to_int(w->str, w->len) : 0;
-
-                mouse::move(x, y);
-            }
-            // MOUSE_CLICK button, CLICK button
-            else if (compare(cmd->str, cmd->len, "MOUSE_CLICK", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "CLICK", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
-                int button   = TU_BIT(w ? to_uint(w->str, w->len) : 0);
-                mouse::click(button);
-            }
-            // MOUSE_PRESS button, PRESS button
-            else if (compare(cmd->str, cmd->len, "MOUSE_PRESS", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "PRESS", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
-                int button   = TU_BIT(w ? to_uint(w->str, w->len) : 0);
-                mouse::press(button);
-            }
-            // MOUSE_RELEASE button, RELEASE button
-            else if (compare(cmd->str, cmd->len, "MOUSE_RELEASE", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "RELEASE", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
-                int button   = TU_BIT(w ? to_uint(w->str, w->len) : 0);
-                mouse::release(button);
-            }
-            // MOUSE_SCROLL v h, SCROLL v h
-            else if (compare(cmd->str, cmd->len, "MOUSE_SCROLL", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "SCROLL", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
-                int vertical = w ? to_int(w->str, w->len) : 0;
-                w = w->next;
-                int horizontal = w ? to_int(w->str, w->len) : 0;
-
-                mouse::scroll(vertical, horizontal);
-            }
-            // IMPORT (-> open another script)
-            else if (compare(cmd->str, cmd->len, "IMPORT", CASE_SENSETIVE)) {
-                import_path = std::string(line_str, line_str_len);
-            }
-            // Otherwise go through words and look for keys to press
-            else {
-                word_node* w = wl->first;
 
-                while (w) {
-                    press(w->str, w->len);
-                    w = w->next;
+                case OP_IMPORT: {
+                    uint16_t len = read_u16(pc);
+
+                    import_path = std::string((const char*)pc, len);
+                    pc         += len;
+                    break;
                 }
 
-                if (line_end) release();
+                // Unknown opcode, the rest of the program can't be decoded
+                default:
+                    debug("Invalid opcode ");
+                    debugln(op);
+                    return;
             }
+        }
+    }
+
+    // Copies the program into next_cache, which becomes the last line once the next one starts
+    void cache_line(const uint8_t* ops, size_t len, bool line_end) {
+        if (next_done) {
+            cache_t tmp = line_cache;
+
+            line_cache = next_cache;
+            next_cache = tmp;
+
+            cache_clear(&next_cache);
+        }
+
+        cache_append(&next_cache, ops, len);
+        next_done = line_end;
+    }
+
+    // Everything that runs between LOOP_BEGIN and LOOP_END is recorded, including REPEATs
+    void cache_loop(const uint8_t* ops, size_t len) {
+        if (recording) {
+            cache_append(&loop_cache, ops, len);
+
+            // IMPORT continues in another file, the loop has to be read from flash
+            if (!import_path.empty()) loop_cache.valid = false;
+            if (loop_end) recording = false;
+        }
+
+        if (loop_begin) {
+            cache_clear(&loop_cache);
+            recording = true;
+        }
+    }
+
+    // Compiles as much of str as fits into program and moves str past it.
+    // Returns the size of the program, 0 if not even one line fits.
+    size_t compile_next(const char** str, size_t* len, bool persistent) {
+        size_t consumed;
+        size_t size = compile(*str, *len, program, PROGRAM_SIZE, &consumed, persistent);
+
+        if (consumed == 0) {
+            debugln("Error, line doesn't fit into PROGRAM_SIZE");
+            return 0;
+        }
+
+        *str += consumed;
+        *len -= consumed;
 
-            n = n->next;
+        return size;
+    }
+
+    void run_program(const uint8_t* ops, size_t len, bool line_end) {
+        cache_line(ops, len, line_end);
+
+        execute(ops);
+        cache_loop(ops, len);
+    }
+
+    // ====== PUBLIC ===== //
+
+    void setDefaultDelay(int defaultDelay) {
+        default_delay = defaultDelay;
+    }
 
-            if (!in_string && !in_comment && !in_ml_comment && !ignore_delay) sleep(default_delay);
+    void parse(const char* str, size_t len, bool persistent) {
+        interpret_timestamp = millis();
+        tasks::update();
+
+        while (len > 0) {
+            size_t size = compile_next(&str, &len, persistent);
+            if (size == 0) return;
 
-            if (line_end && (repeat_num > 0)) --repeat_num;
+            bool line_end = (str[-1] == '\n') || (str[-1] == '\r');
 
-            interpret_timestamp = millis();
-            tasks::update();
+            run_program(program, size - 1, line_end);
         }
+    }
+
+    void parseAgain(const char* str, size_t len, bool persistent) {
+        interpret_timestamp = millis();
+        tasks::update();
 
-        line_list_destroy(l);
+        while (len > 0) {
+            size_t size = compile_next(&str, &len, persistent);
+            if (size == 0) return;
+
+            // Not through run_program(), the cached last line has to stay what it was
+            execute(program);
+            cache_loop(program, size - 1);
+        }
+    }
+
+    void run(const uint8_t* ops, size_t len, bool line_end) {
+        interpret_timestamp = millis();
+        tasks::update();
+
+        run_program(ops, len, line_end);
+    }
+
+    bool replayLine() {
+        if (!line_cache.valid) return false;
+
+        interpret_timestamp = millis();
+
+        execute(line_cache.buf);
+        cache_loop(line_cache.buf, line_cache.len);
+
+        return true;
+    }
+
+    bool replayLoop() {
+        if (recording || !loop_cache.valid) return false;
+
+        interpret_timestamp = millis();
+
+        execute(loop_cache.buf);
+
+        return true;
+    }
+
+    void clearCache() {
+        line_cache.valid = false;
+        next_cache.valid = false;
+        loop_cache.valid = false;
+        next_done        = true;
+        recording        = false;
     }
 
     // https://github.com/hathach/tinyusb/blob/fd5bb6e5db8e8e997d66775e689cc73f149e7fc1/src/class/hid/hid.h#L153
@@ -499,4 +493,12 @@ namespace duckparser {
         import_path.clear();
         return path;
     }
+
+    size_t getArenaPeak() {
+        return arena_high_water();
+    }
+
+    uint8_t* getProgram() {
+        return program;
+    }
 }
\ No newline at end of file
@@ -3,12 +3,29 @@
 #pragma once
 
 #include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
 #include <string> // std::string
 
 namespace duckparser {
     void setDefaultDelay(int defaultDelay);
 
-    void parse(const char* str, size_t len);
+    // persistent: str stays valid until parse() returns and doesn't need to be copied.
+    // Text that doesn't fit into one program is compiled and run in parts.
+    void parse(const char* str, size_t len, bool persistent = false);
+
+    // Same as parse(), for a line that is read again because replayLine() failed.
+    // It isn't cached as the last line, so the REPEAT line doesn't take its place.
+    void parseAgain(const char* str, size_t len, bool persistent = false);
+
+    // Runs ops that were compiled ahead with compile() (see duckparser/compiler.h),
+    // len without the final OP_END. line_end: the compiled text ended with a linebreak.
+    void run(const uint8_t* ops, size_t len, bool line_end);
+
+    // Run the last line or the last loop body again from RAM.
+    // Return false if it didn't fit into REPEAT_CACHE or LOOP_CACHE and has to be parsed again.
+    bool replayLine();
+    bool replayLoop();
+    void clearCache();
 
     int getRepeats();
     unsigned int getDelayTime();
@@ -19,4 +36,9 @@ namespace duckparser {
 
     bool import();
     std::string getImport();
+
+    size_t getArenaPeak();
+
+    // Buffer that parse() compiles into, also used by prefetch on boards with a single core
+    uint8_t* getProgram();
 };
\ No newline at end of file
@@ -0,0 +1,231 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#include "duckparser/keywords.h"
+
+#include "config.h"
+#include "locale/usb_hid_keys.h"
+
+// Both tables are open addressing hash tables that are filled by the compiler.
+// A lookup hashes the word once and then compares only the (very few) entries
+// of its probe sequence, instead of testing every keyword one by one.
+
+#define COMMAND_SLOTS 64
+#define KEY_SLOTS 128
+#define MAX_PROBES 4
+
+namespace duckparser {
+    // ====== PRIVATE ===== //
+    typedef struct keyword_t {
+        const char* name;
+        uint8_t     len;
+        uint8_t     value;    // Command or keycode
+        uint8_t     modifier; // Only used for keys
+    } keyword_t;
+
+    template<size_t N>
+    struct table_t {
+        keyword_t slots[N];
+        size_t    probes; // Longest probe sequence of any entry
+    };
+
+    constexpr char to_upper(char c) {
+        return ((c >= 'a') && (c <= 'z')) ? (char)(c - 32) : c;
+    }
+
+    constexpr uint8_t length(const char* str) {
+        uint8_t len = 0;
+
+        while (str[len]) ++len;
+        return len;
+    }
+
+    // FNV-1a, case folded so that it works with and without CASE_SENSETIVE
+    constexpr uint32_t hash(const char* str, size_t len) {
+        uint32_t h = 2166136261u;
+
+        for (size_t i = 0; i < len; ++i) {
+            h ^= (uint8_t)to_upper(str[i]);
+            h *= 16777619u;
+        }
+
+        return h ^ (h >> 16);
+    }
+
+    template<size_t N, size_t M>
+    constexpr table_t<N> make_table(const keyword_t (& words)[M]) {
+        table_t<N> t {};
+
+        for (size_t i = 0; i < M; ++i) {
+            keyword_t k = words[i];
+
+            k.len = length(k.name);
+
+            size_t slot   = hash(k.name, k.len) % N;
+            size_t probes = 1;
+
+            while (t.slots[slot].name) {
+                slot = (slot + 1) % N;
+                ++probes;
+            }
+
+            t.slots[slot] = k;
+            if (probes > t.probes) t.probes = probes;
+        }
+
+        return t;
+    }
+
+    bool equals(const char* str, size_t len, const keyword_t& k) {
+        if (len != k.len) return false;
+
+        for (size_t i = 0; i < len; ++i) {
+            char c = CASE_SENSETIVE ? str[i] : to_upper(str[i]);
+
+            if (c != k.name[i]) return false;
+        }
+
+        return true;
+    }
+
+    template<size_t N>
+    const keyword_t* find(const table_t<N>& t, const char* str, size_t len) {
+        if (!str || (len == 0) || (len > 0xFF)) return nullptr;
+
+        size_t slot = hash(str, len) % N;
+
+        for (size_t i = 0; i < t.probes && t.slots[slot].name; ++i) {
+            if (equals(str, len, t.slots[slot])) return &t.slots[slot];
+            slot = (slot + 1) % N;
+        }
+
+        return nullptr;
+    }
+
+    constexpr keyword_t command_list[] = {
+        { "REM", 0, CMD_REM, 0 },
+        { "#", 0, CMD_REM, 0 },
+        { "###", 0, CMD_ML_COMMENT, 0 },
+        { "LSTRING_BEGIN", 0, CMD_LSTRING_BEGIN, 0 },
+        { "LSTRING_END", 0, CMD_LSTRING_END, 0 },
+        { "DEFAULTDELAY", 0, CMD_DEFAULT_DELAY, 0 },
+        { "DEFAULT_DELAY", 0, CMD_DEFAULT_DELAY, 0 },
+        { "DELAY", 0, CMD_DELAY, 0 },
+        { "STRING", 0, CMD_STRING, 0 },
+        { "STRINGLN", 0, CMD_STRINGLN, 0 },
+        { "REPEAT", 0, CMD_REPEAT, 0 },
+        { "REPLAY", 0, CMD_REPEAT, 0 },
+        { "LOOP_BEGIN", 0, CMD_LOOP_BEGIN, 0 },
+        { "LOOP_END", 0, CMD_LOOP_END, 0 },
+        { "LOCALE", 0, CMD_LOCALE, 0 },
+        { "LED", 0, CMD_LED, 0 },
+        { "KEYCODE", 0, CMD_KEYCODE, 0 },
+        { "MOUSE", 0, CMD_MOUSE, 0 },
+        { "MOVE", 0, CMD_MOUSE, 0 },
+        { "MOUSE_CLICK", 0, CMD_MOUSE_CLICK, 0 },
+        { "CLICK", 0, CMD_MOUSE_CLICK, 0 },
+        { "MOUSE_PRESS", 0, CMD_MOUSE_PRESS, 0 },
+        { "PRESS", 0, CMD_MOUSE_PRESS, 0 },
+        { "MOUSE_RELEASE", 0, CMD_MOUSE_RELEASE, 0 },
+        { "RELEASE", 0, CMD_MOUSE_RELEASE, 0 },
+        { "MOUSE_SCROLL", 0, CMD_MOUSE_SCROLL, 0 },
+        { "SCROLL", 0, CMD_MOUSE_SCROLL, 0 },
+        { "IMPORT", 0, CMD_IMPORT, 0 },
+    };
+
+    constexpr keyword_t key_list[] = {
+        // Keys
+        { "ENTER", 0, KEY_ENTER, KEY_NONE },
+        { "MENU", 0, KEY_PROPS, KEY_NONE },
+        { "APP", 0, KEY_PROPS, KEY_NONE },
+        { "DELETE", 0, KEY_DELETE, KEY_NONE },
+        { "BACKSPACE", 0, KEY_BACKSPACE, KEY_NONE },
+        { "HOME", 0, KEY_HOME, KEY_NONE },
+        { "INSERT", 0, KEY_INSERT, KEY_NONE },
+        { "PAGEUP", 0, KEY_PAGEUP, KEY_NONE },
+        { "PAGEDOWN", 0, KEY_PAGEDOWN, KEY_NONE },
+        { "UPARROW", 0, KEY_UP, KEY_NONE },
+        { "UP", 0, KEY_UP, KEY_NONE },
+        { "DOWNARROW", 0, KEY_DOWN, KEY_NONE },
+        { "DOWN", 0, KEY_DOWN, KEY_NONE },
+        { "LEFTARROW", 0, KEY_LEFT, KEY_NONE },
+        { "LEFT", 0, KEY_LEFT, KEY_NONE },
+        { "RIGHTARROW", 0, KEY_RIGHT, KEY_NONE },
+        { "RIGHT", 0, KEY_RIGHT, KEY_NONE },
+        { "TAB", 0, KEY_TAB, KEY_NONE },
+        { "END", 0, KEY_END, KEY_NONE },
+        { "ESC", 0, KEY_ESC, KEY_NONE },
+        { "ESCAPE", 0, KEY_ESC, KEY_NONE },
+        { "SPACE", 0, KEY_SPACE, KEY_NONE },
+        { "PAUSE", 0, KEY_PAUSE, KEY_NONE },
+        { "BREAK", 0, KEY_PAUSE, KEY_NONE },
+        { "CAPSLOCK", 0, KEY_CAPSLOCK, KEY_NONE },
+        { "NUMLOCK", 0, KEY_NUMLOCK, KEY_NONE },
+        { "PRINTSCREEN", 0, KEY_SYSRQ, KEY_NONE },
+        { "SCROLLLOCK", 0, KEY_SCROLLLOCK, KEY_NONE },
+
+        // Function Keys
+        { "F1", 0, KEY_F1, KEY_NONE },
+        { "F2", 0, KEY_F2, KEY_NONE },
+        { "F3", 0, KEY_F3, KEY_NONE },
+        { "F4", 0, KEY_F4, KEY_NONE },
+        { "F5", 0, KEY_F5, KEY_NONE },
+        { "F6", 0, KEY_F6, KEY_NONE },
+        { "F7", 0, KEY_F7, KEY_NONE },
+        { "F8", 0, KEY_F8, KEY_NONE },
+        { "F9", 0, KEY_F9, KEY_NONE },
+        { "F10", 0, KEY_F10, KEY_NONE },
+        { "F11", 0, KEY_F11, KEY_NONE },
+        { "F12", 0, KEY_F12, KEY_NONE },
+
+        // NUMPAD KEYS
+        { "NUM_0", 0, KEY_KP0, KEY_NONE },
+        { "NUM_1", 0, KEY_KP1, KEY_NONE },
+        { "NUM_2", 0, KEY_KP2, KEY_NONE },
+        { "NUM_3", 0, KEY_KP3, KEY_NONE },
+        { "NUM_4", 0, KEY_KP4, KEY_NONE },
+        { "NUM_5", 0, KEY_KP5, KEY_NONE },
+        { "NUM_6", 0, KEY_KP6, KEY_NONE },
+        { "NUM_7", 0, KEY_KP7, KEY_NONE },
+        { "NUM_8", 0, KEY_KP8, KEY_NONE },
+        { "NUM_9", 0, KEY_KP9, KEY_NONE },
+        { "NUM_ASTERIX", 0, KEY_KPASTERISK, KEY_NONE },
+        { "NUM_ENTER", 0, KEY_KPENTER, KEY_NONE },
+        { "NUM_MINUS", 0, KEY_KPMINUS, KEY_NONE },
+        { "NUM_DOT", 0, KEY_KPDOT, KEY_NONE },
+        { "NUM_PLUS", 0, KEY_KPPLUS, KEY_NONE },
+
+        // Modifiers
+        { "CTRL", 0, KEY_NONE, KEY_MOD_LCTRL },
+        { "CONTROL", 0, KEY_NONE, KEY_MOD_LCTRL },
+        { "SHIFT", 0, KEY_NONE, KEY_MOD_LSHIFT },
+        { "ALT", 0, KEY_NONE, KEY_MOD_LALT },
+        { "ALTGR", 0, KEY_NONE, KEY_MOD_RALT },
+        { "WINDOWS", 0, KEY_NONE, KEY_MOD_LMETA },
+        { "GUI", 0, KEY_NONE, KEY_MOD_LMETA },
+        { "COMMAND", 0, KEY_NONE, KEY_MOD_LMETA },
+    };
+
+    constexpr table_t<COMMAND_SLOTS> commands = make_table<COMMAND_SLOTS>(command_list);
+    constexpr table_t<KEY_SLOTS> keys         = make_table<KEY_SLOTS>(key_list);
+
+    static_assert(commands.probes <= MAX_PROBES, "Command hash has too many collisions");
+    static_assert(keys.probes <= MAX_PROBES, "Key hash has too many collisions");
+
+    // ====== PUBLIC ===== //
+    Command find_command(const char* str, size_t len) {
+        const keyword_t* k = find(commands, str, len);
+
+        return k ? (Command)k->value : CMD_NONE;
+    }
+
+    bool find_key(const char* str, size_t len, uint8_t* key, uint8_t* modifiers) {
+        const keyword_t* k = find(keys, str, len);
+
+        if (!k) return false;
+
+        *key       = k->value;
+        *modifiers = k->modifier;
+
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+namespace duckparser {
+    enum Command : uint8_t {
+        CMD_NONE,
+        CMD_REM,           // REM, #
+        CMD_ML_COMMENT,    // ###
+        CMD_LSTRING_BEGIN,
+        CMD_LSTRING_END,
+        CMD_DEFAULT_DELAY, // DEFAULTDELAY, DEFAULT_DELAY
+        CMD_DELAY,
+        CMD_STRING,
+        CMD_STRINGLN,
+        CMD_REPEAT,        // REPEAT, REPLAY
+        CMD_LOOP_BEGIN,
+        CMD_LOOP_END,
+        CMD_LOCALE,
+        CMD_LED,
+        CMD_KEYCODE,
+        CMD_MOUSE,         // MOUSE, MOVE
+        CMD_MOUSE_CLICK,   // MOUSE_CLICK, CLICK
+        CMD_MOUSE_PRESS,   // MOUSE_PRESS, PRESS
+        CMD_MOUSE_RELEASE, // MOUSE_RELEASE, RELEASE
+        CMD_MOUSE_SCROLL,  // MOUSE_SCROLL, SCROLL
+        CMD_IMPORT,
+    };
+
+    // Resolve the keyword at the start of a line, CMD_NONE if it isn't one
+    Command find_command(const char* str, size_t len);
+
+    // Resolve a key name (ENTER, F1, CTRL, ...) to a keycode and/or modifier
+    bool find_key(const char* str, size_t len, uint8_t* key, uint8_t* modifiers);
+}
\ No newline at end of file
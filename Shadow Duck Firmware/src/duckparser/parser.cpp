@@ -2,11 +2,19 @@
 
 #include "duckparser/parser.h"
 
-#include <stdlib.h>  // malloc
+#include "config.h"
+
+#include <stdint.h>  // uint8_t
 #include <string.h>  // strlen
 #include <stdbool.h> // bool
 
 namespace duckparser {
+    // Bump allocator for all line and word nodes of a single parse() call.
+    // Nothing is freed individually, arena_reset() drops everything at once.
+    uint8_t arena[PARSER_ARENA_SIZE] __attribute__((aligned(sizeof(void*))));
+    size_t  arena_used = 0;
+    size_t  arena_peak = 0; // Largest demand seen, can exceed PARSER_ARENA_SIZE
+
     // My own implementation, because the default one in ctype.h make problems on older ESP8266 SDKs
     char to_lower(char c) {
         if ((c >= 65) && (c <= 90)) {
@@ -87,9 +95,35 @@ namespace duckparser {
         return COMPARE_UNEQUAL;
     }
 
+    // ===== Arena ===== //
+    void arena_reset() {
+        arena_used = 0;
+    }
+
+    void* arena_alloc(size_t size) {
+        // Keep every node pointer-aligned
+        size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+        size_t demand = arena_used + size;
+
+        if (demand > arena_peak) arena_peak = demand;
+        if (demand > PARSER_ARENA_SIZE) return NULL;
+
+        void* ptr = &arena[arena_used];
+
+        arena_used = demand;
+        return ptr;
+    }
+
+    size_t arena_high_water() {
+        return arena_peak;
+    }
+
     // ===== Word Node ===== //
     word_node* word_node_create(const char* str, size_t len) {
-        word_node* n = (word_node*)malloc(sizeof(word_node));
+        word_node* n = (word_node*)arena_alloc(sizeof(word_node));
+
+        if (!n) return NULL;
 
         n->str  = str;
         n->len  = len;
@@ -97,39 +131,19 @@ namespace duckparser {
         return n;
     }
 
-    word_node* word_node_destroy(word_node* n) {
-        if (n) {
-            free(n);
-        }
-        return NULL;
-    }
-
-    word_node* word_node_destroy_rec(word_node* n) {
-        if (n) {
-            word_node_destroy_rec(n->next);
-            word_node_destroy(n);
-        }
-        return NULL;
-    }
-
     // ===== Word List ===== //
     word_list* word_list_create() {
-        word_list* l = (word_list*)malloc(sizeof(word_list));
+        word_list* l = (word_list*)arena_alloc(sizeof(word_list));
+
+        if (!l) return NULL;
 
         l->first = NULL;
         l->last  = NULL;
         l->size  = 0;
+        l->rest  = NULL;
         return l;
     }
 
-    word_list* word_list_destroy(word_list* l) {
-        if (l) {
-            word_node_destroy_rec(l->first);
-            free(l);
-        }
-        return NULL;
-    }
-
     void word_list_push(word_list* l, word_node* n) {
         if (l && n) {
             if (l->last) {
@@ -158,7 +172,9 @@ namespace duckparser {
 
     // ===== Line Node ==== //
     line_node* line_node_create(const char* str, size_t len) {
-        line_node* n = (line_node*)malloc(sizeof(line_node));
+        line_node* n = (line_node*)arena_alloc(sizeof(line_node));
+
+        if (!n) return NULL;
 
         n->str   = str;
         n->len   = len;
@@ -168,41 +184,20 @@ namespace duckparser {
         return n;
     }
 
-    word_node* line_node_destroy(line_node* n) {
-        if (n) {
-            word_list_destroy(n->words);
-            free(n);
-        }
-        return NULL;
-    }
-
-    word_node* line_node_destroy_rec(line_node* n) {
-        if (n) {
-            line_node_destroy_rec(n->next);
-            line_node_destroy(n);
-        }
-        return NULL;
-    }
-
     // ===== Line List ===== //
     line_list* line_list_create() {
-        line_list* l = (line_list*)malloc(sizeof(line_list));
+        line_list* l = (line_list*)arena_alloc(sizeof(line_list));
+
+        if (!l) return NULL;
 
         l->first = NULL;
         l->last  = NULL;
         l->size  = 0;
+        l->rest  = NULL;
 
         return l;
     }
 
-    line_list* line_list_destroy(line_list* l) {
-        if (l) {
-            line_node_destroy_rec(l->first);
-            free(l);
-        }
-        return NULL;
-    }
-
     void line_list_push(line_list* l, line_node* n) {
         if (l && n) {
             if (l->last) {
@@ -233,7 +228,7 @@ namespace duckparser {
     word_list* parse_words(const char* str, size_t len) {
         word_list* l = word_list_create();
 
-        if (len == 0) return l;
+        if (!l || (len == 0)) return l;
 
         // Go through string and look for space to split it into words
         word_node* n = NULL;
@@ -255,6 +250,12 @@ namespace duckparser {
                 // for every word, add to list
                 if (k > 0) {
                     n = word_node_create(&str[j], k);
+
+                    if (!n) {
+                        l->rest = &str[j];
+                        return l;
+                    }
+
                     word_list_push(l, n);
                 }
 
@@ -270,7 +271,7 @@ namespace duckparser {
     line_list* parse_lines(const char* str, size_t len) {
         line_list* l = line_list_create();
 
-        if (len == 0) return l;
+        if (!l || (len == 0)) return l;
 
         // Go through string and look for \r and \n to split it into lines
         line_node* n = NULL;
@@ -297,18 +298,28 @@ namespace duckparser {
 
             linebreak = /*!in_quotes && */ (curr == '\r' || curr == '\n');
 
+            size_t llen = stri - ls; // length of line (without the linebreak)
+
             // skip \n after \r (windows linebreak)
             if (/*!in_quotes && */ (curr == '\r') && (next == '\n')) ++stri;
 
             endofline = (stri == len) || (curr == '\0');
 
             if (linebreak || endofline || delimiter) {
-                size_t llen = stri - ls; // length of line
 
                 // for every line, parse_words and add to list
                 if (llen > 0) {
-                    n        = line_node_create(&str[ls], llen);
-                    n->words = parse_words(&str[ls], llen);
+                    n = line_node_create(&str[ls], llen);
+
+                    if (n) n->words = parse_words(&str[ls], llen);
+
+                    // Arena is full, the rest is left for the next call.
+                    // Only the first line may miss words, or a long line would never fit.
+                    if (!n || !n->words || (l->first && n->words->rest)) {
+                        l->rest = &str[ls];
+                        return l;
+                    }
+
                     line_list_push(l, n);
                 }
 
@@ -23,6 +23,7 @@ namespace duckparser {
         struct word_node* first;
         struct word_node* last;
         size_t            size;
+        const char      * rest; // First word that didn't fit into the arena, NULL if none
     } word_list;
 
     typedef struct line_node {
@@ -36,28 +37,28 @@ namespace duckparser {
         struct line_node* first;
         struct line_node* last;
         size_t            size;
+        const char      * rest; // First line that didn't fit into the arena, NULL if none
     } line_list;
 
+    // ===== Arena ===== //
+    void arena_reset();
+    void* arena_alloc(size_t size);
+    size_t arena_high_water();
+
     // ===== Word Node ===== //
     word_node* word_node_create(const char* str, size_t len);
-    word_node* word_node_destroy(word_node* n);
-    word_node* word_node_destroy_rec(word_node* n);
 
     // ===== Word List ===== //
     word_list* word_list_create();
-    word_list* word_list_destroy(word_list* l);
 
     void word_list_push(word_list* l, word_node* n);
     word_node* word_list_get(word_list* l, size_t i);
 
     // ===== Line Node ==== //
     line_node* line_node_create(const char* str, size_t len);
-    word_node* line_node_destroy(line_node* n);
-    word_node* line_node_destroy_rec(line_node* n);
 
     // ===== Line List ===== //
     line_list* line_list_create();
-    line_list* line_list_destroy(line_list* l);
 
     void line_list_push(line_list* l, line_node* n);
     line_node* line_list_get(line_list* l, size_t i);
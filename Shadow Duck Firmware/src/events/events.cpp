@@ -0,0 +1,64 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#include "events/events.h"
+
+#include <Arduino.h> // millis(), noInterrupts(), yield()
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <hardware/sync.h> // __sev(), save_and_disable_interrupts()
+#include <pico/time.h>     // best_effort_wfe_or_timeout()
+#else // if defined(ARDUINO_ARCH_RP2040)
+#define MAX_SLEEP 100 // ms, in case an event is missed
+#endif // if defined(ARDUINO_ARCH_RP2040)
+
+namespace events {
+    // ====== PRIVATE ====== //
+    volatile uint32_t pending = 0;
+
+    // ====== PUBLIC ====== //
+    void post(Event event) {
+#if defined(ARDUINO_ARCH_RP2040)
+        uint32_t state = save_and_disable_interrupts();
+
+        pending |= event;
+        restore_interrupts(state);
+
+        // Wakes the core, even if it's just about to go to sleep
+        __sev();
+#else // if defined(ARDUINO_ARCH_RP2040)
+        noInterrupts();
+        pending |= event;
+        interrupts();
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+
+    uint32_t take() {
+        noInterrupts();
+        uint32_t res = pending;
+
+        pending = 0;
+        interrupts();
+
+        return res;
+    }
+
+    void wait(uint32_t timeout) {
+#if defined(ARDUINO_ARCH_RP2040)
+        absolute_time_t until = make_timeout_time_ms(timeout);
+
+        // WFE also returns for other reasons (any interrupt), go back to sleep then
+        while (!pending && !best_effort_wfe_or_timeout(until)) {}
+#else // if defined(ARDUINO_ARCH_RP2040)
+        unsigned long start_time = millis();
+
+        if (timeout > MAX_SLEEP) timeout = MAX_SLEEP;
+
+        // The millis() tick wakes us up every 1 ms.
+        // TinyUSB only handles the bus (and posts EVENT_SERIAL) in yield() here.
+        while (!pending && (millis() - start_time < timeout)) {
+            yield();
+            __WFI();
+        }
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#pragma once
+
+#include <stdint.h> // uint32_t
+
+namespace events {
+    // One bit each, the same event can't pile up
+    enum Event : uint32_t {
+        EVENT_SELECTOR  = 1 << 0, // Mode switch moved
+        EVENT_INDICATOR = 1 << 1, // Host sent the keyboard LEDs (SET_REPORT)
+        EVENT_DRIVE     = 1 << 2, // Host wrote to the USB drive
+        EVENT_SERIAL    = 1 << 3, // Data arrived on the serial port
+    };
+
+    // Can be called from interrupts (and the USB callbacks)
+    void post(Event event);
+
+    // Returns the events since the last call
+    uint32_t take();
+
+    // Sleeps until an event is posted or timeout (ms) has passed
+    void wait(uint32_t timeout);
+}
\ No newline at end of file
@@ -1,17 +1,24 @@
 #include "hid/hid.h"
 
+#include "events/events.h"
+
 #include <Adafruit_TinyUSB.h>
-#include <Arduino.h> // delay()
+#include <Arduino.h> // yield(), noInterrupts(), millis()
+#include <string.h>  // memcpy
 
 namespace hid {
     // ====== PRIVATE ====== //
     uint8_t indicator         = 0;     // Indicator LED state
     bool    indicator_changed = false; // Whether or not any indicator changed since last time
     bool    indicator_read    = false; // If initial indicator was read
+    bool    nkro_enabled      = false; // Keys are sent as a bitmap instead of the 6 key array
+
+    volatile uint32_t ready_time        = 0; // First indicator report of the host
+    volatile uint32_t first_report_time = 0; // First report that was handed to the endpoint
 
-    std::string serial       = "1337";
-    std::string manufacturer = "KobolSystems";
-    std::string product      = "ShadowDuck";
+    const char* serial       = "1337";
+    const char* manufacturer = "KobolSystems";
+    const char* product      = "ShadowDuck";
 
     // HID report descriptor using TinyUSB's template
     // Single Report (no ID) descriptor
@@ -21,10 +28,95 @@ namespace hid {
         TUD_HID_REPORT_DESC_CONSUMER(HID_REPORT_ID(RID::CONSUMER_CONTROL))
     };
 
+    // Same as above, plus a keyboard that reports every key as one bit.
+    // The boot keyboard stays, because a BIOS only understands that one (see nkro()).
+    uint8_t const desc_hid_report_nkro[] = {
+        TUD_HID_REPORT_DESC_KEYBOARD(HID_REPORT_ID(RID::KEYBOARD)),
+        TUD_HID_REPORT_DESC_MOUSE(HID_REPORT_ID(RID::MOUSE)),
+        TUD_HID_REPORT_DESC_CONSUMER(HID_REPORT_ID(RID::CONSUMER_CONTROL)),
+
+        HID_USAGE_PAGE(HID_USAGE_PAGE_DESKTOP),
+        HID_USAGE(HID_USAGE_DESKTOP_KEYBOARD),
+        HID_COLLECTION(HID_COLLECTION_APPLICATION),
+        HID_REPORT_ID(RID::NKRO_KEYBOARD)
+        // 8 bits Modifier Keys (Shift, Control, Alt)
+        HID_USAGE_PAGE(HID_USAGE_PAGE_KEYBOARD),
+        HID_USAGE_MIN(224),
+        HID_USAGE_MAX(231),
+        HID_LOGICAL_MIN(0),
+        HID_LOGICAL_MAX(1),
+        HID_REPORT_COUNT(8),
+        HID_REPORT_SIZE(1),
+        HID_INPUT(HID_DATA | HID_VARIABLE | HID_ABSOLUTE),
+        // 1 bit per key
+        HID_USAGE_MIN(0),
+        HID_USAGE_MAX(NKRO_KEYS - 1),
+        HID_REPORT_COUNT(NKRO_KEYS),
+        HID_REPORT_SIZE(1),
+        HID_INPUT(HID_DATA | HID_VARIABLE | HID_ABSOLUTE),
+        HID_COLLECTION_END
+    };
+
     // USB HID object. For ESP32 these values cannot be changed after this declaration
     // desc report, desc len, protocol, interval, use out endpoint
     Adafruit_USBD_HID usb_hid(desc_hid_report, sizeof(desc_hid_report), HID_ITF_PROTOCOL_KEYBOARD, 2, false);
 
+    // Reports wait here until the endpoint is free.
+    // Filled by send*Report(), drained by tud_hid_report_complete_cb() (USB task).
+    typedef struct report_t {
+        uint8_t id;
+        uint8_t len;
+        uint8_t data[1 + NKRO_KEYS / 8]; // Largest report is the NKRO keyboard
+    } report_t;
+
+    report_t queue[HID_QUEUE];
+
+    volatile uint32_t queue_head = 0; // Next free slot
+    volatile uint32_t queue_tail = 0; // Next report to send
+
+    // Only call it from the USB task or with interrupts disabled
+    void send_next() {
+        if ((queue_head == queue_tail) || !usb_hid.ready()) return;
+
+        report_t* r = &queue[queue_tail % HID_QUEUE];
+
+        if (usb_hid.sendReport(r->id, r->data, r->len)) {
+            if (first_report_time == 0) first_report_time = millis();
+            ++queue_tail;
+        }
+    }
+
+    // Start sending, in case the endpoint is idle and no completion will come
+    void kick() {
+        noInterrupts();
+        send_next();
+        interrupts();
+    }
+
+    void enqueue(uint8_t id, const uint8_t* data, uint8_t len) {
+        if (TinyUSBDevice.suspended()) {
+            // Wake up host if we are in suspend mode
+            // and REMOTE_WAKEUP feature is enabled by host
+            TinyUSBDevice.remoteWakeup();
+        }
+
+        // Wait until there is room for the next report
+        while (queue_head - queue_tail >= HID_QUEUE) {
+            kick();
+            yield();
+        }
+
+        report_t* r = &queue[queue_head % HID_QUEUE];
+
+        r->id  = id;
+        r->len = len;
+        memcpy(r->data, data, len);
+
+        ++queue_head;
+
+        kick();
+    }
+
     // Output report callback for LED indicator such as Caplocks
     void hid_report_callback(uint8_t report_id, hid_report_type_t report_type, uint8_t const* buffer, uint16_t bufsize) {
         (void)report_id;
@@ -38,6 +130,8 @@ namespace hid {
         // Kana (4) | Compose (3) | ScrollLock (2) | CapsLock (1) | Numlock (0)
         uint8_t tmp = buffer[0];
 
+        events::post(events::EVENT_INDICATOR);
+
         // Save caps lock state
         if (tmp != indicator) {
             indicator         = tmp;
@@ -48,6 +142,7 @@ namespace hid {
         if (!indicator_read) {
             indicator_read    = true;
             indicator_changed = false;
+            ready_time        = millis();
         }
 
         // turn on LED if capslock is set
@@ -55,11 +150,23 @@ namespace hid {
     }
 
     // ====== PUBLIC ====== //
+    void setNKRO(bool enable) {
+        nkro_enabled = enable;
+    }
+
+    bool nkro() {
+        // A host in boot protocol (BIOS, boot loader) didn't parse the descriptor and only reads
+        // the 6 key report. There's no way to tell whether a host in report protocol uses the
+        // NKRO collection, so it's expected to, like every OS does.
+        return nkro_enabled && (tud_hid_get_protocol() != HID_PROTOCOL_BOOT);
+    }
+
     void init() {
         // Notes: following commented-out functions has no affect on ESP32
         usb_hid.setBootProtocol(HID_ITF_PROTOCOL_KEYBOARD);
         // usb_hid.setPollInterval(2);
         // usb_hid.setReportDescriptor(desc_hid_report, sizeof(desc_hid_report));
+        if (nkro_enabled) usb_hid.setReportDescriptor(desc_hid_report_nkro, sizeof(desc_hid_report_nkro));
         // usb_hid.setStringDescriptor("TinyUSB Keyboard");
 
         // Set up output report (on control endpoint) for Capslock indicator
@@ -73,53 +180,80 @@ namespace hid {
         TinyUSBDevice.setDeviceVersion(version);
     }
 
-    void setSerial(std::string serialstr) {
+    void setSerial(const char* serialstr) {
         hid::serial = serialstr;
-        TinyUSBDevice.setSerialDescriptor(serial.c_str());
+        TinyUSBDevice.setSerialDescriptor(serial);
     }
 
-    void setManufacturer(std::string manufacturerstr) {
+    void setManufacturer(const char* manufacturerstr) {
         hid::manufacturer = manufacturerstr;
-        TinyUSBDevice.setManufacturerDescriptor(manufacturer.c_str());
+        TinyUSBDevice.setManufacturerDescriptor(manufacturer);
     }
 
-    void setProduct(std::string productstr) {
+    void setProduct(const char* productstr) {
         hid::product = productstr;
-        TinyUSBDevice.setProductDescriptor(product.c_str());
+        TinyUSBDevice.setProductDescriptor(product);
     }
 
     bool mounted() {
         return TinyUSBDevice.mounted();
     }
 
+    bool ready() {
+        return mounted() && indicator_read;
+    }
+
+    uint32_t getReadyTime() {
+        return ready_time;
+    }
+
+    uint32_t getFirstReportTime() {
+        return first_report_time;
+    }
+
     void sendKeyboardReport(uint8_t modifier, uint8_t* keys) {
-        if (TinyUSBDevice.suspended()) {
-            // Wake up host if we are in suspend mode
-            // and REMOTE_WAKEUP feature is enabled by host
-            TinyUSBDevice.remoteWakeup();
-        }
+        // Both keyboards share the key state on the host, so stick to one of them
+        if (nkro()) {
+            uint8_t bitmap[NKRO_KEYS / 8] = { 0 };
 
-        // Wait until ready to send next report
-        while (!usb_hid.ready()) {
-            delay(1);
+            for (uint8_t i = 0; keys && i < 6; ++i) {
+                if ((keys[i] != 0) && (keys[i] < NKRO_KEYS)) bitmap[keys[i] / 8] |= 1 << (keys[i] % 8);
+            }
+
+            sendNKROReport(modifier, bitmap);
+            return;
         }
 
-        usb_hid.keyboardReport(RID::KEYBOARD, modifier, keys);
+        // Same layout as hid_keyboard_report_t
+        uint8_t report[8] = { modifier, 0 };
+
+        if (keys) memcpy(&report[2], keys, 6);
+
+        // Boot protocol reports have no ID
+        if (tud_hid_get_protocol() == HID_PROTOCOL_BOOT) enqueue(0, report, sizeof(report));
+        else enqueue(RID::KEYBOARD, report, sizeof(report));
+    }
+
+    void sendNKROReport(uint8_t modifier, const uint8_t* bitmap) {
+        uint8_t report[1 + NKRO_KEYS / 8] = { modifier };
+
+        memcpy(&report[1], bitmap, NKRO_KEYS / 8);
+
+        enqueue(RID::NKRO_KEYBOARD, report, sizeof(report));
     }
 
     void sendMouseReport(uint8_t buttons, int8_t x, int8_t y, int8_t vertical, int8_t horizontal) {
-        if (TinyUSBDevice.suspended()) {
-            // Wake up host if we are in suspend mode
-            // and REMOTE_WAKEUP feature is enabled by host
-            TinyUSBDevice.remoteWakeup();
-        }
+        // Same layout as hid_mouse_report_t
+        uint8_t report[5] = { buttons, (uint8_t)x, (uint8_t)y, (uint8_t)vertical, (uint8_t)horizontal };
 
-        // Wait until ready to send next report
-        while (!usb_hid.ready()) {
-            delay(1);
-        }
+        enqueue(RID::MOUSE, report, sizeof(report));
+    }
 
-        usb_hid.mouseReport(RID::MOUSE, buttons, x, y, vertical, horizontal);
+    void flush() {
+        while (queue_head != queue_tail) {
+            kick();
+            yield();
+        }
     }
 
     uint8_t getIndicator() {
@@ -132,4 +266,13 @@ namespace hid {
         indicator_changed = false;
         return res;
     }
+}
+
+// Invoked by TinyUSB when a report was sent, so the next one goes out with the next poll
+extern "C" void tud_hid_report_complete_cb(uint8_t instance, uint8_t const* report, uint16_t len) {
+    (void)instance;
+    (void)report;
+    (void)len;
+
+    hid::send_next();
 }
\ No newline at end of file
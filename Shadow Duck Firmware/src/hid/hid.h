@@ -5,7 +5,9 @@
 #include "config.h"
 
 #include <cstdint> // uint8_t
-#include <string>  // std::string
+
+// Keys of the NKRO bitmap (usages 0x00 - 0x9F, covers all keys of the locales)
+#define NKRO_KEYS 160
 
 namespace hid {
     // Report ID
@@ -13,19 +15,38 @@ namespace hid {
         KEYBOARD         = 1,
         MOUSE            = 2,
         CONSUMER_CONTROL = 3, // Media, volume etc ..
+        NKRO_KEYBOARD    = 4, // Modifiers + bitmap of all keys
     };
 
+    // Adds the N-key-rollover keyboard to the descriptor, call it before init()
+    void setNKRO(bool enable);
+    bool nkro(); // Whether keys go out as NKRO bitmap, false while the host uses boot protocol
+
     void init();
     void setID(uint16_t vid, uint16_t pid, uint16_t version);
-    void setSerial(std::string serialstr);
-    void setManufacturer(std::string manufacturerstr);
-    void setProduct(std::string productstr);
+    // The strings aren't copied, they have to stay valid
+    void setSerial(const char* serialstr);
+    void setManufacturer(const char* manufacturerstr);
+    void setProduct(const char* productstr);
 
     bool mounted();
 
+    // Host configured the device and sent the first indicator state (SET_REPORT),
+    // from then on it processes keystrokes
+    bool ready();
+
+    // When (millis since reset) the host got ready and the first report was sent, 0 if not yet
+    uint32_t getReadyTime();
+    uint32_t getFirstReportTime();
+
+    // Reports are queued and sent one per poll interval, these only block if the queue is full
     void sendKeyboardReport(uint8_t modifier, uint8_t* keys);
+    void sendNKROReport(uint8_t modifier, const uint8_t* bitmap); // NKRO_KEYS/8 bytes
     void sendMouseReport(uint8_t buttons, int8_t x, int8_t y, int8_t vertical, int8_t horizontal);
 
+    // Wait until all queued reports were sent
+    void flush();
+
     uint8_t getIndicator();
     bool indicatorChanged();
 }
\ No newline at end of file
@@ -3,14 +3,33 @@
 #include "hid/keyboard.h"
 
 #include "hid/hid.h"
-#include <Arduino.h> // pgm_read_byte
+#include "locale/utf8.h"
+#include <string.h> // memset
+
+#if defined(LOCALE_FIXED)
+#include "locale/locales.h"
+#endif // if defined(LOCALE_FIXED)
 
 namespace keyboard {
     // ====== PRIVATE ====== //
-    hid_locale_t* locale { locale::get_default() };
+    const hid_locale_t* locale { locale::get_default() };
 
     report_t prev_report = report_t{ KEY_NONE, { KEY_NONE, KEY_NONE, KEY_NONE, KEY_NONE, KEY_NONE, KEY_NONE } };
 
+    // Pressed keys when NKRO is enabled, prev_report.keys is unused then
+    uint8_t key_bits[NKRO_KEYS / 8] = { 0 };
+
+    // prev_report contains keys of type() that weren't sent yet
+    bool    pending     = false;
+    uint8_t pending_max = KEY_NONE; // Highest key of them
+
+    uint32_t prev_code = 0; // Last character of type()
+
+    typedef struct stroke_t {
+        uint8_t modifiers;
+        uint8_t key;
+    } stroke_t;
+
     report_t make_report(uint8_t modifiers = 0, uint8_t key1 = 0, uint8_t key2 = 0, uint8_t key3 = 0, uint8_t key4 = 0, uint8_t key5 = 0, uint8_t key6 = 0);
 
     report_t make_report(uint8_t modifiers, uint8_t key1, uint8_t key2, uint8_t key3, uint8_t key4, uint8_t key5, uint8_t key6) {
@@ -28,143 +47,283 @@ namespace keyboard {
         return k;
     }
 
-    // ====== PUBLIC ====== //
-    void setLocale(hid_locale_t* locale) {
-        if (locale == nullptr) return;
-        keyboard::locale = locale;
-    }
+    // Key strokes of a character, combinations (accent keys) have two
+    typedef struct keys_t {
+        stroke_t strokes[2];
+        uint8_t  n;
+    } keys_t;
 
-    void send(report_t* k) {
-        hid::sendKeyboardReport(k->modifiers, k->keys);
+    typedef struct ascii_table_t {
+        keys_t keys[128];
+    } ascii_table_t;
+
+    // Apply the differences of the locale to the base layout,
+    // so ASCII characters are a single array access
+    constexpr ascii_table_t make_ascii(const uint8_t* base, const hid_locale_t& l) {
+        ascii_table_t t {};
+
+        for (uint8_t i = 0; i < 128; ++i) {
+            t.keys[i].n          = 1;
+            t.keys[i].strokes[0] = stroke_t{ base[i * 2], base[(i * 2) + 1] };
+        }
+
+        for (size_t i = 0; i < l.ascii_len; ++i) {
+            const uint8_t* row = l.ascii + (i * 3);
+
+            t.keys[row[0] & 0x7F].strokes[0] = stroke_t{ row[1], row[2] };
+        }
+
+        // Key combinations (accent keys) come before ASCII keys, they are sorted to the start of the table
+        for (size_t i = 0; i < l.combinations_len; ++i) {
+            const uint8_t* row = l.combinations + (i * 6);
+
+            if ((row[1] != 0) || (row[0] >= 128)) break;
+
+            t.keys[row[0]].n          = 2;
+            t.keys[row[0]].strokes[0] = stroke_t{ row[2], row[3] };
+            t.keys[row[0]].strokes[1] = stroke_t{ row[4], row[5] };
+        }
+
+        return t;
     }
 
-    void release() {
-        prev_report = make_report();
-        send(&prev_report);
+    // Binary search in a table that is sorted by its u16 code point, returns the row or nullptr
+    inline const uint8_t* search(const uint8_t* table, size_t len, size_t width, uint32_t code) {
+        size_t lo = 0;
+        size_t hi = len;
+
+        while (lo < hi) {
+            size_t   mid      = (lo + hi) / 2;
+            uint32_t mid_code = table[mid * width] | (table[(mid * width) + 1] << 8);
+
+            if (mid_code == code) return table + (mid * width);
+            if (mid_code < code) lo = mid + 1;
+            else hi = mid;
+        }
+
+        return nullptr;
     }
 
-    void pressKey(uint8_t key, uint8_t modifiers) {
-        for (uint8_t i = 0; i < 6; ++i) {
-            if (prev_report.keys[i] == KEY_NONE) {
-                prev_report.modifiers |= modifiers;
-                prev_report.keys[i]    = key;
-                send(&prev_report);
-                return;
-            }
+    // Key strokes of a character (Unicode code point) in the locale l, ascii has to be made from l.
+    // Key combinations (accent keys) have two strokes, the others one, 0 if the locale doesn't have it.
+    inline uint8_t lookup(const hid_locale_t& l, const ascii_table_t& ascii, uint32_t code, stroke_t* strokes) {
+        // Linebreaks
+        if ((code == '\n') || (code == '\r')) {
+            strokes[0] = stroke_t{ KEY_NONE, KEY_ENTER };
+            return 1;
+        }
+
+        // ASCII
+        if (code < 128) {
+            const keys_t& k = ascii.keys[code];
+
+            for (uint8_t i = 0; i < k.n; ++i) strokes[i] = k.strokes[i];
+            return k.n;
+        }
+
+        // Key combinations (accent keys) first, then UTF8
+        const uint8_t* row = search(l.combinations, l.combinations_len, 6, code);
+
+        if (row) {
+            strokes[0] = stroke_t{ row[2], row[3] };
+            strokes[1] = stroke_t{ row[4], row[5] };
+            return 2;
         }
+
+        row = search(l.utf8, l.utf8_len, 4, code);
+
+        if (row) {
+            strokes[0] = stroke_t{ row[2], row[3] };
+            return 1;
+        }
+
+        return 0;
     }
 
-    void pressModifier(uint8_t key) {
-        prev_report.modifiers |= key;
+#if defined(LOCALE_FIXED)
+    // Only one layout is built in (custom_locales in platformio.ini).
+    // Its tables are constants, so the compiler can fold them into the lookup and the ASCII table is made at compile time.
+    constexpr ascii_table_t fixed_ascii = make_ascii(ascii_base, LOCALE_FIXED);
 
-        send(&prev_report);
+    uint8_t find(uint32_t code, stroke_t* strokes) {
+        return lookup(LOCALE_FIXED, fixed_ascii, code, strokes);
     }
 
-    uint8_t press(const char* strPtr) {
-        // Check for linebreaks
-        if ((*strPtr == '\n') || (*strPtr == '\r')) {
-            pressKey(KEY_ENTER);
-            return 1;
+#else // if defined(LOCALE_FIXED)
+    // ASCII table of the current locale, made when the locale changes
+    const hid_locale_t* ascii_locale = nullptr;
+    ascii_table_t ascii_keys;
+
+    uint8_t find(uint32_t code, stroke_t* strokes) {
+        if (ascii_locale != locale) {
+            ascii_keys   = make_ascii(locale::get_ascii_base(), *locale);
+            ascii_locale = locale;
         }
 
-        // Convert string pointer into a byte pointer
-        uint8_t* b = (uint8_t*)strPtr;
+        return lookup(*locale, ascii_keys, code, strokes);
+    }
+
+#endif // if defined(LOCALE_FIXED)
+    bool is_pressed(uint8_t key) {
+        if (hid::nkro()) return (key < NKRO_KEYS) && (key_bits[key / 8] & (1 << (key % 8)));
 
-        // Key combinations (accent keys)
-        // We have to check them first, because sometimes ASCII keys are in here
-        for (uint8_t i = 0; i<locale->combinations_len; ++i) {
-            uint8_t res = 0;
+        for (uint8_t i = 0; i < 6; ++i) {
+            if (prev_report.keys[i] == key) return true;
+        }
 
-            // Read utf8 code and match it with the given data
-            for (uint8_t j = 0; j<4; ++j) {
-                uint8_t key_code = pgm_read_byte(locale->combinations + (i * 8) + j);
+        return false;
+    }
 
-                if (key_code == 0) {
-                    break;
-                }
+    uint8_t count_pressed() {
+        uint8_t used = 0;
 
-                if (key_code == b[j]) {
-                    ++res;
-                } else {
-                    res = 0;
-                    break;
-                }
+        if (hid::nkro()) {
+            for (uint8_t i = 0; i < NKRO_KEYS / 8; ++i) used += __builtin_popcount(key_bits[i]);
+        } else {
+            for (uint8_t i = 0; i < 6; ++i) {
+                if (prev_report.keys[i] != KEY_NONE) ++used;
             }
+        }
 
-            // If a match was found, read out the data and type it
-            if (res > 0) {
-                uint8_t comboModifiers = pgm_read_byte(locale->combinations + (i * 8) + 4);
-                uint8_t comboKey       = pgm_read_byte(locale->combinations + (i * 8) + 5);
+        return used;
+    }
 
-                uint8_t modifiers = pgm_read_byte(locale->combinations + (i * 8) + 6);
-                uint8_t key       = pgm_read_byte(locale->combinations + (i * 8) + 7);
+    // Returns false if there is no free slot for the key
+    bool add_key(uint8_t key) {
+        if (key == KEY_NONE) return true;
 
-                pressKey(comboKey, comboModifiers);
-                release();
-                pressKey(key, modifiers);
+        if (hid::nkro()) {
+            if (key >= NKRO_KEYS) return false;
+            key_bits[key / 8] |= 1 << (key % 8);
+            return true;
+        }
 
-                // Return the number of extra bytes we used from the string pointer
-                return res-1;
+        for (uint8_t i = 0; i < 6; ++i) {
+            if (prev_report.keys[i] == KEY_NONE) {
+                prev_report.keys[i] = key;
+                return true;
             }
         }
 
-        // ASCII
-        if (b[0] < locale->ascii_len) {
-            uint8_t modifiers = pgm_read_byte(locale->ascii + (b[0] * 2) + 0);
-            uint8_t key       = pgm_read_byte(locale->ascii + (b[0] * 2) + 1);
+        return false;
+    }
+
+    void send_pressed() {
+        if (hid::nkro()) hid::sendNKROReport(prev_report.modifiers, key_bits);
+        else send(&prev_report);
+
+        pending     = false;
+        pending_max = KEY_NONE;
+    }
+
+    // Whether the stroke can be added to the keys that are currently pressed,
+    // without releasing them first
+    bool fits(const stroke_t& stroke) {
+        if (is_pressed(stroke.key)) return false;
+
+        uint8_t used = count_pressed();
+
+        if (used == 0) return true;
+        if (prev_report.modifiers != stroke.modifiers) return false;
 
-            pressKey(key, modifiers);
+        return hid::nkro() || (used < 6);
+    }
+
+    // ====== PUBLIC ====== //
+    bool setLocale(const hid_locale_t* locale) {
+        if (locale == nullptr) return false;
 
-            return 0;
+#if defined(LOCALE_FIXED)
+        // find() always uses the built-in layout
+        if (locale != &LOCALE_FIXED) return false;
+#endif // if defined(LOCALE_FIXED)
+
+        keyboard::locale = locale;
+        return true;
+    }
+
+    void send(report_t* k) {
+        hid::sendKeyboardReport(k->modifiers, k->keys);
+    }
+
+    void release() {
+        // Keys collected by type() go out in one report, before they are released
+        if (pending) send_pressed();
+
+        prev_report = make_report();
+        memset(key_bits, 0, sizeof(key_bits));
+        send_pressed();
+    }
+
+    void pressKey(uint8_t key, uint8_t modifiers) {
+        if (!add_key(key)) return;
+
+        prev_report.modifiers |= modifiers;
+        send_pressed();
+    }
+
+    void pressModifier(uint8_t key) {
+        prev_report.modifiers |= key;
+        send_pressed();
+    }
+
+    void press(uint32_t code) {
+        stroke_t strokes[2];
+        uint8_t  n = find(code, strokes);
+
+        // Key combinations (accent keys) are released between their strokes
+        for (uint8_t i = 0; i < n; ++i) {
+            if (i > 0) release();
+            pressKey(strokes[i].key, strokes[i].modifiers);
         }
+    }
+
+    void type(uint32_t code) {
+        // \r\n is a single linebreak
+        bool crlf = (code == '\n') && (prev_code == '\r');
+
+        prev_code = code;
+        if (crlf) return;
 
-        // UTF8
-        for (size_t i = 0; i < locale->utf8_len; ++i) {
-            uint8_t res = 0;
+        stroke_t strokes[2];
+        uint8_t  n = find(code, strokes);
 
-            // Read utf8 code and match it with the given data
-            for (uint8_t j = 0; j < 4; ++j) {
-                uint8_t key_code = pgm_read_byte(locale->utf8 + (i * 6) + j);
+        for (uint8_t i = 0; i < n; ++i) {
+            if (strokes[i].key == KEY_NONE) continue;
 
-                if (key_code == 0) {
-                    break;
-                }
+            // Every stroke of a combination (accent key and character) goes out alone.
+            // Keys of earlier or later characters in the same report would reach the host at the same time.
+            bool combination = n > 1;
 
-                if (key_code == b[j]) {
-                    ++res;
-                } else {
-                    res = 0;
-                    break;
-                }
+            if (!fits(strokes[i]) || (combination && count_pressed())) {
+                release();
+            } else if (pending && (strokes[i].key < pending_max) && hid::nkro()) {
+                // The host reads a bitmap in key order,
+                // so keys that were typed out of order have to go out one report after another
+                send_pressed();
             }
 
-            // If a match was found, read out the data and type it
-            if (res > 0) {
-                uint8_t modifiers = pgm_read_byte(locale->utf8 + (i * 6) + 4);
-                uint8_t key       = pgm_read_byte(locale->utf8 + (i * 6) + 5);
+            prev_report.modifiers = strokes[i].modifiers;
+            add_key(strokes[i].key);
+            pending = true;
 
-                pressKey(key, modifiers);
+            if (strokes[i].key > pending_max) pending_max = strokes[i].key;
 
-                // Return the number of extra bytes we used from the string pointer
-                return res - 1;
-            }
+            if (combination) release();
         }
-
-        return 0;
     }
 
-    uint8_t write(const char* c) {
-        uint8_t res = press(c);
-
+    void write(uint32_t code) {
+        press(code);
         release();
-        
-        // returns the number of extra bytes we used from the string pointer
-        return res;
     }
 
     void write(const char* str, size_t len) {
+        utf8::decoder_t decoder = { 0, 0, 0 };
+        uint32_t code;
+
         for (size_t i = 0; i < len; ++i) {
-            i += write(&str[i]);
+            if (utf8::feed(&decoder, str[i], &code)) write(code);
         }
     }
 
@@ -8,7 +8,8 @@ namespace keyboard {
         uint8_t keys[6];
     } report_t;
 
-    void setLocale(hid_locale_t* locale);
+    // Returns false if the layout isn't built in (nullptr, or another one than LOCALE_FIXED)
+    bool setLocale(const hid_locale_t* locale);
 
     void send(report_t* k);
     void release();
@@ -16,10 +17,16 @@ namespace keyboard {
     void pressKey(uint8_t key, uint8_t modifiers = KEY_NONE);
     void pressModifier(uint8_t key);
 
-    uint8_t press(const char* strPtr);
+    // Characters are Unicode code points, see utf8::feed()
+    void press(uint32_t code);
 
-    uint8_t write(const char* c);
-    void write(const char* str, size_t len);
+    // Like write(), but keys are collected and sent together
+    // (up to 6 with the same modifiers, or any number of them with NKRO).
+    // Call release() after the last character.
+    void type(uint32_t code);
+
+    void write(uint32_t code);
+    void write(const char* str, size_t len); // UTF-8
 
     void disableCapslock();
     bool indicatorChanged();
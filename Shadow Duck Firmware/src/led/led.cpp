@@ -3,6 +3,7 @@
 #include "led/led.h"
 
 #include "config.h"
+#include "tasks/tasks.h"
 
 #include <Arduino.h>           // pinMode(), analogWrite(), millis()
 #include <Adafruit_NeoPixel.h> // Adafruit_NeoPixel
@@ -12,9 +13,8 @@ namespace led {
     Adafruit_NeoPixel led { 1, LED_PIN, NEO_GRB + NEO_KHZ800 };
 
     int blink_color[3] { 0, 0, 0 };
-    unsigned long blink_intv { 0 };
-    unsigned long last_blink { 0 };
     bool blink_flag { false };
+    int  blink_task { -1 };
 
     void change_color(int r, int g, int b) {
         if (LED_PIN < 0) return;
@@ -26,12 +26,25 @@ namespace led {
         led.show();
     }
 
+    // Task that runs every blink interval
+    void blink() {
+        blink_flag = !blink_flag;
+
+        if (blink_flag) {
+            change_color(blink_color[0], blink_color[1], blink_color[2]);
+        } else {
+            change_color(0, 0, 0);
+        }
+    }
+
     // ========== PUBLIC ========= //
     void init() {
         if (LED_PIN < 0) return;
 
         led.begin();
         led.show();
+
+        blink_task = tasks::add("led", blink, 0);
     }
 
     void setEnable(bool enabled) {
@@ -54,8 +67,9 @@ namespace led {
         blink_color[0] = r;
         blink_color[1] = g;
         blink_color[2] = b;
-        blink_intv     = intv;
         blink_flag     = false;
+
+        tasks::setInterval(blink_task, intv);
     }
 
     void setMode(Color color, Mode mode) {
@@ -77,17 +91,4 @@ namespace led {
                 setColor(0, 0, 0);
         }
     }
-
-    void update() {
-        if ((blink_intv > 0) && (millis() - last_blink >= blink_intv)) {
-            last_blink = millis();
-            blink_flag = !blink_flag;
-
-            if (blink_flag) {
-                change_color(blink_color[0], blink_color[1], blink_color[2]);
-            } else {
-                change_color(0, 0, 0);
-            }
-        }
-    }
 }
\ No newline at end of file
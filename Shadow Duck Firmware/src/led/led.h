@@ -25,6 +25,4 @@ namespace led {
     void setColor(int r, int g, int b, unsigned long intv = 0);
 
     void setMode(Color color, Mode mode);
-
-    void update();
 }
\ No newline at end of file
@@ -6,6 +6,14 @@
 #include "locale/usb_hid_keys.h"
 
 namespace locale {
-    hid_locale_t* get_default();
-    hid_locale_t* get(const char* name);
+    const hid_locale_t* get_default();
+    const uint8_t* get_ascii_base(); // Modifiers and key of all 128 ASCII characters in the US layout
+
+    // Case insensitive, '-' and '_' are the same ("DE", "ca-fr", "US_MAC")
+    const hid_locale_t* get(const char* name, size_t len);
+    const hid_locale_t* get(const char* name);
+
+    // All locales, sorted by name
+    size_t count();
+    const char* get_name(size_t i);
 }
\ No newline at end of file
@@ -5,13 +5,19 @@
 #include <cstdint> // uint8_t
 #include <cstddef> // size_t
 
+// Tables are generated by scripts/locale_gen.py, see locale/locales.h
 typedef struct hid_locale_t {
-    uint8_t* ascii;
-    uint8_t  ascii_len;
+    const uint8_t* ascii; // Differences to locale::get_ascii_base(): char, modifiers, key
+    uint8_t        ascii_len;
 
-    uint8_t* utf8;
-    size_t   utf8_len;
+    const uint8_t* utf8; // Sorted by code point: u16 code point, modifiers, key
+    size_t         utf8_len;
 
-    uint8_t* combinations;
-    size_t   combinations_len;
-} hid_locale_t;
\ No newline at end of file
+    const uint8_t* combinations; // Sorted by code point: u16 code point, modifiers, key, modifiers, key
+    size_t         combinations_len;
+} hid_locale_t;
+
+typedef struct hid_locale_name_t {
+    const char        * name;
+    const hid_locale_t* locale;
+} hid_locale_name_t;
\ No newline at end of file
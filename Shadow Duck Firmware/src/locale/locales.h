@@ -0,0 +1,10019 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+// Generated by scripts/locale_gen.py from the layouts in locale/win and locale/mac, don't edit!
+
+#pragma once
+
+#include "locale/locale_types.h"
+#include "locale/usb_hid_keys.h"
+
+// Without any LOCALE_<NAME> define all layouts are built in
+#if !defined(LOCALE_BE) && !defined(LOCALE_BE_MAC) && !defined(LOCALE_BG) && !defined(LOCALE_BG_MAC) && \
+    !defined(LOCALE_CA_CMS) && !defined(LOCALE_CA_FR) && !defined(LOCALE_CA_FR_MAC) && !defined(LOCALE_CH_DE) && \
+    !defined(LOCALE_CH_DE_MAC) && !defined(LOCALE_CH_FR) && !defined(LOCALE_CH_FR_MAC) && !defined(LOCALE_CZ) && \
+    !defined(LOCALE_CZ_MAC) && !defined(LOCALE_DE) && !defined(LOCALE_DE_MAC) && !defined(LOCALE_DK) && \
+    !defined(LOCALE_DK_MAC) && !defined(LOCALE_EE) && !defined(LOCALE_EE_MAC) && !defined(LOCALE_ES) && \
+    !defined(LOCALE_ES_LA) && !defined(LOCALE_ES_LA_MAC) && !defined(LOCALE_ES_MAC) && !defined(LOCALE_FI) && \
+    !defined(LOCALE_FI_MAC) && !defined(LOCALE_FR) && !defined(LOCALE_FR_MAC) && !defined(LOCALE_GB) && \
+    !defined(LOCALE_GB_MAC) && !defined(LOCALE_GR) && !defined(LOCALE_GR_MAC) && !defined(LOCALE_HR) && \
+    !defined(LOCALE_HR_MAC) && !defined(LOCALE_HU) && !defined(LOCALE_HU_MAC) && !defined(LOCALE_IE) && \
+    !defined(LOCALE_IN) && !defined(LOCALE_IN_MAC) && !defined(LOCALE_IS) && !defined(LOCALE_IS_MAC) && \
+    !defined(LOCALE_IT) && !defined(LOCALE_IT_MAC) && !defined(LOCALE_LT) && !defined(LOCALE_LT_MAC) && \
+    !defined(LOCALE_LV) && !defined(LOCALE_LV_MAC) && !defined(LOCALE_NL) && !defined(LOCALE_NL_MAC) && \
+    !defined(LOCALE_NO) && !defined(LOCALE_NO_MAC) && !defined(LOCALE_PL) && !defined(LOCALE_PL_MAC) && \
+    !defined(LOCALE_PT) && !defined(LOCALE_PT_BR) && !defined(LOCALE_PT_BR_MAC) && !defined(LOCALE_PT_MAC) && \
+    !defined(LOCALE_RO) && !defined(LOCALE_RO_MAC) && !defined(LOCALE_RU) && !defined(LOCALE_RU_MAC) && \
+    !defined(LOCALE_SE) && !defined(LOCALE_SE_MAC) && !defined(LOCALE_SI) && !defined(LOCALE_SI_MAC) && \
+    !defined(LOCALE_SK) && !defined(LOCALE_SK_MAC) && !defined(LOCALE_TR) && !defined(LOCALE_TR_MAC) && \
+    !defined(LOCALE_UA) && !defined(LOCALE_UA_MAC) && !defined(LOCALE_US) && !defined(LOCALE_US_MAC)
+#define LOCALE_ALL
+#endif
+
+// Modifier(s), Key
+inline constexpr uint8_t ascii_base[] = {
+    KEY_NONE,               KEY_NONE,           // NUL
+    KEY_NONE,               KEY_NONE,           // SOH
+    KEY_NONE,               KEY_NONE,           // STX
+    KEY_NONE,               KEY_NONE,           // ETX
+    KEY_NONE,               KEY_NONE,           // EOT
+    KEY_NONE,               KEY_NONE,           // ENQ
+    KEY_NONE,               KEY_NONE,           // ACK
+    KEY_NONE,               KEY_NONE,           // BEL
+    KEY_NONE,               KEY_BACKSPACE,      // BS Backspace
+    KEY_NONE,               KEY_TAB,            // TAB Tab
+    KEY_NONE,               KEY_ENTER,          // LF Enter
+    KEY_NONE,               KEY_NONE,           // VT
+    KEY_NONE,               KEY_NONE,           // FF
+    KEY_NONE,               KEY_NONE,           // CR
+    KEY_NONE,               KEY_NONE,           // SO
+    KEY_NONE,               KEY_NONE,           // SI
+    KEY_NONE,               KEY_NONE,           // DEL
+    KEY_NONE,               KEY_NONE,           // DC1
+    KEY_NONE,               KEY_NONE,           // DC2
+    KEY_NONE,               KEY_NONE,           // DC3
+    KEY_NONE,               KEY_NONE,           // DC4
+    KEY_NONE,               KEY_NONE,           // NAK
+    KEY_NONE,               KEY_NONE,           // SYN
+    KEY_NONE,               KEY_NONE,           // ETB
+    KEY_NONE,               KEY_NONE,           // CAN
+    KEY_NONE,               KEY_NONE,           // EM
+    KEY_NONE,               KEY_NONE,           // SUB
+    KEY_NONE,               KEY_NONE,           // ESC
+    KEY_NONE,               KEY_NONE,           // FS
+    KEY_NONE,               KEY_NONE,           // GS
+    KEY_NONE,               KEY_NONE,           // RS
+    KEY_NONE,               KEY_NONE,           // US
+    KEY_NONE,               KEY_SPACE,          // ' '
+    KEY_MOD_LSHIFT,         KEY_1,              // !
+    KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // "
+    KEY_MOD_LSHIFT,         KEY_3,              // #
+    KEY_MOD_LSHIFT,         KEY_4,              // $
+    KEY_MOD_LSHIFT,         KEY_5,              // %
+    KEY_MOD_LSHIFT,         KEY_7,              // &
+    KEY_NONE,               KEY_APOSTROPHE,     // '
+    KEY_MOD_LSHIFT,         KEY_9,              // (
+    KEY_MOD_LSHIFT,         KEY_0,              // )
+    KEY_MOD_LSHIFT,         KEY_8,              // *
+    KEY_MOD_LSHIFT,         KEY_EQUAL,          // +
+    KEY_NONE,               KEY_COMMA,          // ,
+    KEY_NONE,               KEY_MINUS,          // -
+    KEY_NONE,               KEY_DOT,            // .
+    KEY_NONE,               KEY_SLASH,          // /
+    KEY_NONE,               KEY_0,              // 0
+    KEY_NONE,               KEY_1,              // 1
+    KEY_NONE,               KEY_2,              // 2
+    KEY_NONE,               KEY_3,              // 3
+    KEY_NONE,               KEY_4,              // 4
+    KEY_NONE,               KEY_5,              // 5
+    KEY_NONE,               KEY_6,              // 6
+    KEY_NONE,               KEY_7,              // 7
+    KEY_NONE,               KEY_8,              // 8
+    KEY_NONE,               KEY_9,              // 9
+    KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // :
+    KEY_NONE,               KEY_SEMICOLON,      // ;
+    KEY_MOD_LSHIFT,         KEY_COMMA,          // <
+    KEY_NONE,               KEY_EQUAL,          // =
+    KEY_MOD_LSHIFT,         KEY_DOT,            // >
+    KEY_MOD_LSHIFT,         KEY_SLASH,          // ?
+    KEY_MOD_LSHIFT,         KEY_2,              // @
+    KEY_MOD_LSHIFT,         KEY_A,              // A
+    KEY_MOD_LSHIFT,         KEY_B,              // B
+    KEY_MOD_LSHIFT,         KEY_C,              // C
+    KEY_MOD_LSHIFT,         KEY_D,              // D
+    KEY_MOD_LSHIFT,         KEY_E,              // E
+    KEY_MOD_LSHIFT,         KEY_F,              // F
+    KEY_MOD_LSHIFT,         KEY_G,              // G
+    KEY_MOD_LSHIFT,         KEY_H,              // H
+    KEY_MOD_LSHIFT,         KEY_I,              // I
+    KEY_MOD_LSHIFT,         KEY_J,              // J
+    KEY_MOD_LSHIFT,         KEY_K,              // K
+    KEY_MOD_LSHIFT,         KEY_L,              // L
+    KEY_MOD_LSHIFT,         KEY_M,              // M
+    KEY_MOD_LSHIFT,         KEY_N,              // N
+    KEY_MOD_LSHIFT,         KEY_O,              // O
+    KEY_MOD_LSHIFT,         KEY_P,              // P
+    KEY_MOD_LSHIFT,         KEY_Q,              // Q
+    KEY_MOD_LSHIFT,         KEY_R,              // R
+    KEY_MOD_LSHIFT,         KEY_S,              // S
+    KEY_MOD_LSHIFT,         KEY_T,              // T
+    KEY_MOD_LSHIFT,         KEY_U,              // U
+    KEY_MOD_LSHIFT,         KEY_V,              // V
+    KEY_MOD_LSHIFT,         KEY_W,              // W
+    KEY_MOD_LSHIFT,         KEY_X,              // X
+    KEY_MOD_LSHIFT,         KEY_Y,              // Y
+    KEY_MOD_LSHIFT,         KEY_Z,              // Z
+    KEY_NONE,               KEY_LEFTBRACE,      // [
+    KEY_NONE,               KEY_BACKSLASH,      // bslash
+    KEY_NONE,               KEY_RIGHTBRACE,     // ]
+    KEY_MOD_LSHIFT,         KEY_6,              // ^
+    KEY_MOD_LSHIFT,         KEY_MINUS,          // _
+    KEY_NONE,               KEY_GRAVE,          // `
+    KEY_NONE,               KEY_A,              // a
+    KEY_NONE,               KEY_B,              // b
+    KEY_NONE,               KEY_C,              // c
+    KEY_NONE,               KEY_D,              // d
+    KEY_NONE,               KEY_E,              // e
+    KEY_NONE,               KEY_F,              // f
+    KEY_NONE,               KEY_G,              // g
+    KEY_NONE,               KEY_H,              // h
+    KEY_NONE,               KEY_I,              // i
+    KEY_NONE,               KEY_J,              // j
+    KEY_NONE,               KEY_K,              // k
+    KEY_NONE,               KEY_L,              // l
+    KEY_NONE,               KEY_M,              // m
+    KEY_NONE,               KEY_N,              // n
+    KEY_NONE,               KEY_O,              // o
+    KEY_NONE,               KEY_P,              // p
+    KEY_NONE,               KEY_Q,              // q
+    KEY_NONE,               KEY_R,              // r
+    KEY_NONE,               KEY_S,              // s
+    KEY_NONE,               KEY_T,              // t
+    KEY_NONE,               KEY_U,              // u
+    KEY_NONE,               KEY_V,              // v
+    KEY_NONE,               KEY_W,              // w
+    KEY_NONE,               KEY_X,              // x
+    KEY_NONE,               KEY_Y,              // y
+    KEY_NONE,               KEY_Z,              // z
+    KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // {
+    KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // |
+    KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // }
+    KEY_MOD_LSHIFT,         KEY_GRAVE,          // ~
+    KEY_NONE,               KEY_DELETE          // DEL
+};
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BE_MAC) || defined(LOCALE_FR_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_be_mac[] = {
+    0x21, KEY_NONE,               KEY_8,              // !
+    0x22, KEY_NONE,               KEY_3,              // "
+    0x23, KEY_MOD_LSHIFT,         KEY_GRAVE,          // #
+    0x24, KEY_NONE,               KEY_RIGHTBRACE,     // $
+    0x25, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // %
+    0x26, KEY_NONE,               KEY_1,              // &
+    0x27, KEY_NONE,               KEY_4,              // '
+    0x28, KEY_NONE,               KEY_5,              // (
+    0x29, KEY_NONE,               KEY_MINUS,          // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_SLASH,          // +
+    0x2C, KEY_NONE,               KEY_M,              // ,
+    0x2D, KEY_NONE,               KEY_EQUAL,          // -
+    0x2E, KEY_MOD_LSHIFT,         KEY_COMMA,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_DOT,            // /
+    0x30, KEY_MOD_LSHIFT,         KEY_0,              // 0
+    0x31, KEY_MOD_LSHIFT,         KEY_1,              // 1
+    0x32, KEY_MOD_LSHIFT,         KEY_2,              // 2
+    0x33, KEY_MOD_LSHIFT,         KEY_3,              // 3
+    0x34, KEY_MOD_LSHIFT,         KEY_4,              // 4
+    0x35, KEY_MOD_LSHIFT,         KEY_5,              // 5
+    0x36, KEY_MOD_LSHIFT,         KEY_6,              // 6
+    0x37, KEY_MOD_LSHIFT,         KEY_7,              // 7
+    0x38, KEY_MOD_LSHIFT,         KEY_8,              // 8
+    0x39, KEY_MOD_LSHIFT,         KEY_9,              // 9
+    0x3A, KEY_NONE,               KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_NONE,               KEY_SLASH,          // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_M,              // ?
+    0x40, KEY_NONE,               KEY_GRAVE,          // @
+    0x41, KEY_MOD_LSHIFT,         KEY_Q,              // A
+    0x4D, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // M
+    0x51, KEY_MOD_LSHIFT,         KEY_A,              // Q
+    0x57, KEY_MOD_LSHIFT,         KEY_Z,              // W
+    0x5A, KEY_MOD_LSHIFT,         KEY_W,              // Z
+    0x5B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // [
+    0x5C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // bslash
+    0x5D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_EQUAL,          // _
+    0x60, KEY_NONE,               KEY_BACKSLASH,      // `
+    0x61, KEY_NONE,               KEY_Q,              // a
+    0x6D, KEY_NONE,               KEY_NONE,           // m
+    0x71, KEY_NONE,               KEY_A,              // q
+    0x77, KEY_NONE,               KEY_Z,              // w
+    0x7A, KEY_NONE,               KEY_W,              // z
+    0x7B, KEY_MOD_LALT,           KEY_5,              // {
+    0x7C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // |
+    0x7D, KEY_MOD_LALT,           KEY_MINUS,          // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BE_MAC) || defined(LOCALE_FR_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_be_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_8,              // ¡
+    0xA2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // ¢
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // £
+    0xA5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_6,              // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_C,              // ©
+    0xAA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_7,              // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_MINUS,          // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_6,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ·
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_U,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // Á
+    0xC2, 0x00, KEY_MOD_LALT,           KEY_W,              // Â
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Æ
+    0xC7, 0x00, KEY_MOD_LALT,           KEY_9,              // Ç
+    0xC8, 0x00, KEY_MOD_LALT,           KEY_K,              // È
+    0xCA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ê
+    0xCB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // Ë
+    0xCC, 0x00, KEY_MOD_LALT,           KEY_H,              // Ì
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Î
+    0xCF, 0x00, KEY_MOD_LALT,           KEY_J,              // Ï
+    0xD2, 0x00, KEY_MOD_LALT,           KEY_S,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // Ø
+    0xD9, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // Ù
+    0xDA, 0x00, KEY_MOD_LALT,           KEY_Y,              // Ú
+    0xDB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // Û
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_B,              // ß
+    0xE0, 0x00, KEY_NONE,               KEY_0,              // à
+    0xE5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_Q,              // æ
+    0xE7, 0x00, KEY_NONE,               KEY_9,              // ç
+    0xE8, 0x00, KEY_NONE,               KEY_7,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_2,              // é
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_2,              // ë
+    0xEE, 0x00, KEY_MOD_LALT,           KEY_I,              // î
+    0xEF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ï
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      // ô
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_DOT,            // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_0,              // ø
+    0xF9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ù
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_O,              // œ
+    0x78, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Ÿ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xA9, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // –
+    0x14, 0x20, KEY_MOD_LALT,           KEY_EQUAL,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_4,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_3,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, KEY_MOD_LALT,           KEY_A,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_GRAVE,          // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_Z,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ∑
+    0x1A, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_M,              // ∞
+    0x2B, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_SLASH,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, KEY_MOD_LALT,           KEY_V,              // ◊
+    0xFF, 0xF8, KEY_MOD_LALT,           KEY_1,              // 
+    0x01, 0xFB, KEY_MOD_LALT,           KEY_G,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BE_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_be_mac[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ^
+    0x7E, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_Q,              // À
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_Q,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Q,              // Ä
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_Q,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_Q,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_Q,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Q,              // ä
+    0xEC, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_I,              // í
+    0xF2, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_O,              // ó
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xFA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ü
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Y,              // ÿ
+    0x01, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_J               // ́
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BE_MAC)
+inline constexpr hid_locale_t locale_be_mac {
+    ascii_be_mac, sizeof(ascii_be_mac) / 3,
+    utf8_be_mac, sizeof(utf8_be_mac) / 4,
+    combinations_be_mac, sizeof(combinations_be_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BG_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_bg_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_4,              // "
+    0x23, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // #
+    0x24, KEY_MOD_LALT,           KEY_3,              // $
+    0x26, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // &
+    0x27, KEY_NONE,               KEY_NONE,           // '
+    0x28, KEY_NONE,               KEY_BACKSLASH,      // (
+    0x29, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // )
+    0x2A, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_3,              // +
+    0x2C, KEY_NONE,               KEY_Q,              // ,
+    0x2E, KEY_NONE,               KEY_EQUAL,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_8,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_7,              // :
+    0x3B, KEY_NONE,               KEY_RIGHTBRACE,     // ;
+    0x3C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_6,              // =
+    0x3E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_2,              // ?
+    0x40, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // @
+    0x41, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // A
+    0x42, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // B
+    0x43, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // C
+    0x44, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // D
+    0x45, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // E
+    0x46, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // F
+    0x47, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // G
+    0x48, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // H
+    0x49, KEY_MOD_LSHIFT,         KEY_MINUS,          // I
+    0x4A, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // J
+    0x4B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // K
+    0x4C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // L
+    0x4D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // M
+    0x4E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // N
+    0x4F, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // O
+    0x50, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // P
+    0x51, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Q
+    0x52, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // R
+    0x53, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // S
+    0x54, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // T
+    0x55, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // U
+    0x56, KEY_MOD_LSHIFT,         KEY_EQUAL,          // V
+    0x57, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // W
+    0x58, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // X
+    0x59, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Y
+    0x5A, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Z
+    0x5B, KEY_MOD_LALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_NONE,               KEY_NONE,           // bslash
+    0x5D, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_9,              // _
+    0x60, KEY_NONE,               KEY_RO,             // `
+    0x61, KEY_MOD_LALT,           KEY_A,              // a
+    0x62, KEY_MOD_LALT,           KEY_B,              // b
+    0x63, KEY_MOD_LALT,           KEY_C,              // c
+    0x64, KEY_MOD_LALT,           KEY_D,              // d
+    0x65, KEY_MOD_LALT,           KEY_E,              // e
+    0x66, KEY_MOD_LALT,           KEY_F,              // f
+    0x67, KEY_MOD_LALT,           KEY_G,              // g
+    0x68, KEY_MOD_LALT,           KEY_H,              // h
+    0x69, KEY_MOD_LALT,           KEY_I,              // i
+    0x6A, KEY_MOD_LALT,           KEY_J,              // j
+    0x6B, KEY_MOD_LALT,           KEY_K,              // k
+    0x6C, KEY_MOD_LALT,           KEY_L,              // l
+    0x6D, KEY_MOD_LALT,           KEY_M,              // m
+    0x6E, KEY_MOD_LALT,           KEY_N,              // n
+    0x6F, KEY_MOD_LALT,           KEY_O,              // o
+    0x70, KEY_MOD_LALT,           KEY_P,              // p
+    0x71, KEY_MOD_LALT,           KEY_Q,              // q
+    0x72, KEY_MOD_LALT,           KEY_R,              // r
+    0x73, KEY_MOD_LALT,           KEY_S,              // s
+    0x74, KEY_MOD_LALT,           KEY_T,              // t
+    0x75, KEY_MOD_LALT,           KEY_U,              // u
+    0x76, KEY_MOD_LALT,           KEY_V,              // v
+    0x77, KEY_MOD_LALT,           KEY_W,              // w
+    0x78, KEY_MOD_LALT,           KEY_X,              // x
+    0x79, KEY_MOD_LALT,           KEY_Y,              // y
+    0x7A, KEY_MOD_LALT,           KEY_Z,              // z
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // {
+    0x7C, KEY_NONE,               KEY_NONE,           // |
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // }
+    0x7E, KEY_MOD_LSHIFT,         KEY_102ND           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BG_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_bg_mac[] = {
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_7,              // £
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_2,              // °
+    0xB1, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ±
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_9,              // ¶
+    0x10, 0x04, KEY_MOD_LSHIFT,         KEY_D,              // А
+    0x11, 0x04, KEY_MOD_LSHIFT,         KEY_SLASH,          // Б
+    0x12, 0x04, KEY_MOD_LSHIFT,         KEY_L,              // В
+    0x13, 0x04, KEY_MOD_LSHIFT,         KEY_H,              // Г
+    0x14, 0x04, KEY_MOD_LSHIFT,         KEY_O,              // Д
+    0x15, 0x04, KEY_MOD_LSHIFT,         KEY_E,              // Е
+    0x16, 0x04, KEY_MOD_LSHIFT,         KEY_G,              // Ж
+    0x17, 0x04, KEY_MOD_LSHIFT,         KEY_P,              // З
+    0x18, 0x04, KEY_MOD_LSHIFT,         KEY_R,              // И
+    0x19, 0x04, KEY_MOD_LSHIFT,         KEY_X,              // Й
+    0x1A, 0x04, KEY_MOD_LSHIFT,         KEY_U,              // К
+    0x1B, 0x04, KEY_MOD_LSHIFT,         KEY_DOT,            // Л
+    0x1C, 0x04, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // М
+    0x1D, 0x04, KEY_MOD_LSHIFT,         KEY_K,              // Н
+    0x1E, 0x04, KEY_MOD_LSHIFT,         KEY_F,              // О
+    0x1F, 0x04, KEY_MOD_LSHIFT,         KEY_M,              // П
+    0x20, 0x04, KEY_MOD_LSHIFT,         KEY_COMMA,          // Р
+    0x21, 0x04, KEY_MOD_LSHIFT,         KEY_I,              // С
+    0x22, 0x04, KEY_MOD_LSHIFT,         KEY_J,              // Т
+    0x23, 0x04, KEY_MOD_LSHIFT,         KEY_W,              // У
+    0x24, 0x04, KEY_MOD_LSHIFT,         KEY_B,              // Ф
+    0x25, 0x04, KEY_MOD_LSHIFT,         KEY_N,              // Х
+    0x26, 0x04, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ц
+    0x27, 0x04, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ч
+    0x28, 0x04, KEY_MOD_LSHIFT,         KEY_T,              // Ш
+    0x29, 0x04, KEY_MOD_LSHIFT,         KEY_Y,              // Щ
+    0x2A, 0x04, KEY_MOD_LSHIFT,         KEY_C,              // Ъ
+    0x2D, 0x04, KEY_MOD_LSHIFT,         KEY_V,              // Э
+    0x2E, 0x04, KEY_MOD_LSHIFT,         KEY_Z,              // Ю
+    0x2F, 0x04, KEY_MOD_LSHIFT,         KEY_S,              // Я
+    0x30, 0x04, KEY_NONE,               KEY_D,              // а
+    0x31, 0x04, KEY_NONE,               KEY_SLASH,          // б
+    0x32, 0x04, KEY_NONE,               KEY_L,              // в
+    0x33, 0x04, KEY_NONE,               KEY_H,              // г
+    0x34, 0x04, KEY_NONE,               KEY_O,              // д
+    0x35, 0x04, KEY_NONE,               KEY_E,              // е
+    0x36, 0x04, KEY_NONE,               KEY_G,              // ж
+    0x37, 0x04, KEY_NONE,               KEY_P,              // з
+    0x38, 0x04, KEY_NONE,               KEY_R,              // и
+    0x39, 0x04, KEY_NONE,               KEY_X,              // й
+    0x3A, 0x04, KEY_NONE,               KEY_U,              // к
+    0x3B, 0x04, KEY_NONE,               KEY_DOT,            // л
+    0x3C, 0x04, KEY_NONE,               KEY_SEMICOLON,      // м
+    0x3D, 0x04, KEY_NONE,               KEY_K,              // н
+    0x3E, 0x04, KEY_NONE,               KEY_F,              // о
+    0x3F, 0x04, KEY_NONE,               KEY_M,              // п
+    0x40, 0x04, KEY_NONE,               KEY_COMMA,          // р
+    0x41, 0x04, KEY_NONE,               KEY_I,              // с
+    0x42, 0x04, KEY_NONE,               KEY_J,              // т
+    0x43, 0x04, KEY_NONE,               KEY_W,              // у
+    0x44, 0x04, KEY_NONE,               KEY_B,              // ф
+    0x45, 0x04, KEY_NONE,               KEY_N,              // х
+    0x46, 0x04, KEY_NONE,               KEY_LEFTBRACE,      // ц
+    0x47, 0x04, KEY_NONE,               KEY_APOSTROPHE,     // ч
+    0x48, 0x04, KEY_NONE,               KEY_T,              // ш
+    0x49, 0x04, KEY_NONE,               KEY_Y,              // щ
+    0x4A, 0x04, KEY_NONE,               KEY_C,              // ъ
+    0x4B, 0x04, KEY_MOD_LSHIFT,         KEY_Q,              // ы
+    0x4C, 0x04, KEY_NONE,               KEY_A,              // ь
+    0x4D, 0x04, KEY_NONE,               KEY_V,              // э
+    0x4E, 0x04, KEY_NONE,               KEY_Z,              // ю
+    0x4F, 0x04, KEY_NONE,               KEY_S,              // я
+    0x5D, 0x04, KEY_MOD_LSHIFT,         KEY_A,              // ѝ
+    0x90, 0x04, KEY_MOD_LALT,           KEY_8,              // Ґ
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_BACKSLASH,      // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // ’
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_APOSTROPHE,     // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_4,              // „
+    0x20, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_0,              // •
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_1,              // €
+    0x16, 0x21, KEY_MOD_LSHIFT,         KEY_0,              // №
+    0x22, 0x21, KEY_MOD_LALT,           KEY_5,              // ™
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_6               // ∞
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BG_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_bg_mac[] = {
+    0x02, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_D,              // Ђ
+    0x03, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_E,              // Ѓ
+    0x04, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_R,              // Є
+    0x07, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_F,              // Ї
+    0x09, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_W,              // Љ
+    0x0A, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_C,              // Њ
+    0x0B, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_V,              // Ћ
+    0x0E, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_Z,              // Ў
+    0x0F, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_S,              // Џ
+    0x52, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_D,              // ђ
+    0x53, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_E,              // ѓ
+    0x54, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_R,              // є
+    0x57, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_F,              // ї
+    0x59, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_W,              // љ
+    0x5A, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_C,              // њ
+    0x5B, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_V,              // ћ
+    0x5C, 0x04, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_Q,              // ќ
+    0x5E, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_Z,              // ў
+    0x5F, 0x04, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_S               // џ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BG_MAC)
+inline constexpr hid_locale_t locale_bg_mac {
+    ascii_bg_mac, sizeof(ascii_bg_mac) / 3,
+    utf8_bg_mac, sizeof(utf8_bg_mac) / 4,
+    combinations_bg_mac, sizeof(combinations_bg_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ca_fr_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_DOT,            // "
+    0x27, KEY_MOD_LSHIFT,         KEY_COMMA,          // '
+    0x2F, KEY_NONE,               KEY_GRAVE,          // /
+    0x3C, KEY_MOD_LALT,           KEY_COMMA,          // <
+    0x3E, KEY_MOD_LALT,           KEY_DOT,            // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_6,              // ?
+    0x5B, KEY_MOD_LALT,           KEY_9,              // [
+    0x5C, KEY_MOD_LSHIFT,         KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_0,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x60, KEY_MOD_LALT,           KEY_BACKSLASH,      // `
+    0x7B, KEY_MOD_LALT,           KEY_7,              // {
+    0x7C, KEY_MOD_LALT,           KEY_MINUS,          // |
+    0x7D, KEY_MOD_LALT,           KEY_8,              // }
+    0x7E, KEY_MOD_LALT,           KEY_RIGHTBRACE      // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ca_fr_mac[] = {
+    0xA0, 0x00, KEY_MOD_LALT,           KEY_L,
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_C,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_D,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_Z,              // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          // ¬
+    0xAE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ¯
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_R,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // ·
+    0xBA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // º
+    0xBB, 0x00, KEY_MOD_LALT,           KEY_X,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¿
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // À
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Æ
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ç
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // È
+    0xC9, 0x00, KEY_MOD_LSHIFT,         KEY_SLASH,          // É
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          // Ù
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE0, 0x00, KEY_NONE,               KEY_BACKSLASH,      // à
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_A,              // æ
+    0xE7, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ç
+    0xE8, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // è
+    0xE9, 0x00, KEY_NONE,               KEY_SLASH,          // é
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0xF9, 0x00, KEY_NONE,               KEY_102ND,          // ù
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ˆ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ˘
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_H,              // ˙
+    0xDA, 0x02, KEY_MOD_LALT,           KEY_K,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // ˝
+    0xA9, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_I,              // π
+    0x13, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // —
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_P,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // „
+    0x20, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ‡
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // •
+    0x26, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_4,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_T,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_E,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ≈
+    0x60, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ≠
+    0x64, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ca_fr_mac[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ^
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE,          // ´
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xCA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // ä
+    0xEA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xFA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ü
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Y,              // ÿ
+    0x78, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Y               // Ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR_MAC)
+inline constexpr hid_locale_t locale_ca_fr_mac {
+    ascii_ca_fr_mac, sizeof(ascii_ca_fr_mac) / 3,
+    utf8_ca_fr_mac, sizeof(utf8_ca_fr_mac) / 4,
+    combinations_ca_fr_mac, sizeof(combinations_ca_fr_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE_MAC) || defined(LOCALE_CH_FR_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ch_de_mac[] = {
+    0x21, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // !
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_LALT,           KEY_3,              // #
+    0x24, KEY_NONE,               KEY_BACKSLASH,      // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_3,              // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_1,              // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_G,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_LALT,           KEY_5,              // [
+    0x5C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // bslash
+    0x5D, KEY_MOD_LALT,           KEY_6,              // ]
+    0x5E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_LALT,           KEY_8,              // {
+    0x7C, KEY_MOD_LALT,           KEY_7,              // |
+    0x7D, KEY_MOD_LALT,           KEY_9,              // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ch_de_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_I,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // ¢
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Z,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_C,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_H,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_COMMA,          // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ¯
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xB1, 0x00, KEY_MOD_LALT,           KEY_1,              // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // ·
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_J,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // »
+    0xBF, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Á
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, KEY_MOD_LALT,           KEY_4,              // Ç
+    0xC8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // È
+    0xCB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ë
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Î
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // Ò
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xD9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ù
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // Ú
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // à
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LSHIFT,         KEY_4,              // ç
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // è
+    0xE9, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // é
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0xFC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ü
+    0xFF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ÿ
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x78, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Ÿ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // ˆ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // ˘
+    0xD9, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ˚
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ˜
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Y,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_2,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ‡
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_K,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // 
+    0x01, 0xFB, KEY_MOD_LALT,           KEY_GRAVE,          // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE_MAC) || defined(LOCALE_CH_FR_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ch_de_mac[] = {
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC2, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xCA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDB, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE2, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xEA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xEE, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFB, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE_MAC)
+inline constexpr hid_locale_t locale_ch_de_mac {
+    ascii_ch_de_mac, sizeof(ascii_ch_de_mac) / 3,
+    utf8_ch_de_mac, sizeof(utf8_ch_de_mac) / 4,
+    combinations_ch_de_mac, sizeof(combinations_ch_de_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_FR_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ch_fr_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_I,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // ¢
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Z,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_C,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_H,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_COMMA,          // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ¯
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xB1, 0x00, KEY_MOD_LALT,           KEY_1,              // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // ·
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_J,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // »
+    0xBF, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Á
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, KEY_MOD_LALT,           KEY_4,              // Ç
+    0xC8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // È
+    0xCB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ë
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Î
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // Ò
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xD9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ù
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // Ú
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE0, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // à
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // ä
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LSHIFT,         KEY_4,              // ç
+    0xE8, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // è
+    0xE9, 0x00, KEY_NONE,               KEY_SEMICOLON,      // é
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // ö
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // ü
+    0xFF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ÿ
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x78, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Ÿ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // ˆ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // ˘
+    0xD9, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ˚
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ˜
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Y,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_2,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ‡
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_K,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // 
+    0x01, 0xFB, KEY_MOD_LALT,           KEY_GRAVE,          // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_FR_MAC)
+inline constexpr hid_locale_t locale_ch_fr_mac {
+    ascii_ch_de_mac, sizeof(ascii_ch_de_mac) / 3,
+    utf8_ch_fr_mac, sizeof(utf8_ch_fr_mac) / 4,
+    combinations_ch_de_mac, sizeof(combinations_ch_de_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_cz_mac[] = {
+    0x21, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // !
+    0x22, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // "
+    0x23, KEY_MOD_LALT,           KEY_3,              // #
+    0x24, KEY_MOD_LALT,           KEY_4,              // $
+    0x25, KEY_MOD_LSHIFT,         KEY_MINUS,          // %
+    0x26, KEY_MOD_LALT,           KEY_7,              // &
+    0x27, KEY_MOD_LALT,           KEY_APOSTROPHE,     // '
+    0x28, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // (
+    0x29, KEY_NONE,               KEY_RIGHTBRACE,     // )
+    0x2A, KEY_MOD_LALT,           KEY_8,              // *
+    0x2B, KEY_NONE,               KEY_1,              // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // /
+    0x30, KEY_MOD_LSHIFT,         KEY_0,              // 0
+    0x31, KEY_MOD_LSHIFT,         KEY_1,              // 1
+    0x32, KEY_MOD_LSHIFT,         KEY_2,              // 2
+    0x33, KEY_MOD_LSHIFT,         KEY_3,              // 3
+    0x34, KEY_MOD_LSHIFT,         KEY_4,              // 4
+    0x35, KEY_MOD_LSHIFT,         KEY_5,              // 5
+    0x36, KEY_MOD_LSHIFT,         KEY_6,              // 6
+    0x37, KEY_MOD_LSHIFT,         KEY_7,              // 7
+    0x38, KEY_MOD_LSHIFT,         KEY_8,              // 8
+    0x39, KEY_MOD_LSHIFT,         KEY_9,              // 9
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_NONE,           // ;
+    0x3C, KEY_NONE,               KEY_GRAVE,          // <
+    0x3D, KEY_NONE,               KEY_MINUS,          // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_GRAVE,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_COMMA,          // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_NONE,               KEY_NONE,           // [
+    0x5C, KEY_NONE,               KEY_102ND,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_MOD_LALT,           KEY_6,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_LALT,           KEY_9,              // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_102ND,          // |
+    0x7D, KEY_MOD_LALT,           KEY_0,              // }
+    0x7E, KEY_MOD_LALT,           KEY_5               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_cz_mac[] = {
+    0xA3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // £
+    0xA7, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // §
+    0xA8, 0x00, KEY_NONE,               KEY_BACKSLASH,      // ¨
+    0xA9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // ©
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ¬
+    0xAE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ®
+    0xB6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ¶
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // »
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE1, 0x00, KEY_NONE,               KEY_8,              // á
+    0xE9, 0x00, KEY_NONE,               KEY_0,              // é
+    0xED, 0x00, KEY_NONE,               KEY_9,              // í
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // ÷
+    0xFA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ú
+    0xFD, 0x00, KEY_NONE,               KEY_7,              // ý
+    0x04, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_LALT,           KEY_A,              // ą
+    0x0D, 0x01, KEY_NONE,               KEY_4,              // č
+    0x16, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Ė
+    0x17, 0x01, KEY_MOD_LALT,           KEY_W,              // ė
+    0x18, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_LALT,           KEY_E,              // ę
+    0x1B, 0x01, KEY_NONE,               KEY_2,              // ě
+    0x41, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_LALT,           KEY_L,              // ł
+    0x59, 0x01, KEY_NONE,               KEY_5,              // ř
+    0x61, 0x01, KEY_NONE,               KEY_3,              // š
+    0x7B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Ż
+    0x7C, 0x01, KEY_MOD_LALT,           KEY_Y,              // ż
+    0x7E, 0x01, KEY_NONE,               KEY_6,              // ž
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_H,              // ‘
+    0x19, 0x20, KEY_MOD_LALT,           KEY_J,              // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_N,              // ‚
+    0x1C, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // „
+    0x20, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // †
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // •
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ›
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_R,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x11, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ∑
+    0x1A, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // √
+    0x60, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_GRAVE,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5               // ◊
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_cz_mac[] = {
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_SPACE,          // °
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC4, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDC, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Z,              // Ý
+    0xE4, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // ä
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ö
+    0xFC, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ü
+    0x06, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_C,              // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0E, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_D,              // ď
+    0x1A, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x22, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_G,              // Ģ
+    0x23, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_G,              // ģ
+    0x2E, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_I,              // Į
+    0x2F, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_I,              // į
+    0x39, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ĺ
+    0x3A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_L,              // ĺ
+    0x3B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_L,              // Ļ
+    0x3C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_L,              // ļ
+    0x3D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ľ
+    0x3E, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_L,              // ľ
+    0x43, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_N,              // ń
+    0x45, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_N,              // Ņ
+    0x46, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_N,              // ņ
+    0x47, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_N,              // ň
+    0x50, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ő
+    0x54, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ŕ
+    0x55, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_R,              // ŕ
+    0x56, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_R,              // Ŗ
+    0x57, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_R,              // ŗ
+    0x58, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x5A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_S,              // ś
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Š
+    0x64, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x65, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_T,              // ť
+    0x6E, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ů
+    0x6F, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ů
+    0x70, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ű
+    0x72, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_U,              // Ų
+    0x73, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_U,              // ų
+    0x79, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ź
+    0x7A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ź
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ž
+    0xC7, 0x02, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE           // ˇ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ_MAC)
+inline constexpr hid_locale_t locale_cz_mac {
+    ascii_cz_mac, sizeof(ascii_cz_mac) / 3,
+    utf8_cz_mac, sizeof(utf8_cz_mac) / 4,
+    combinations_cz_mac, sizeof(combinations_cz_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DE_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_de_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_NONE,               KEY_BACKSLASH,      // #
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_NONE,               KEY_RIGHTBRACE,     // +
+    0x2C, KEY_NONE,               KEY_NONE,           // ,
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_L,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_LALT,           KEY_5,              // [
+    0x5C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // bslash
+    0x5D, KEY_MOD_LALT,           KEY_6,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_LALT,           KEY_8,              // {
+    0x7C, KEY_MOD_LALT,           KEY_7,              // |
+    0x7D, KEY_MOD_LALT,           KEY_9,              // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DE_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_de_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Z,              // ¥
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_H,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_Q,              // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ¯
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xB1, 0x00, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_3,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xB8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ¸
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_J,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // »
+    0xBF, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Á
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ä
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xCC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ì
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ö
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xD9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // Ù
+    0xDB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ü
+    0xDF, 0x00, KEY_NONE,               KEY_MINUS,          // ß
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0xFC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ü
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_SEMICOLON,      // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ˆ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ˘
+    0xD9, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Y,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_BACKSLASH,      // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_S,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_2,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_GRAVE,          // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ›
+    0x44, 0x20, KEY_MOD_LALT,           KEY_I,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_K,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DE_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_de_mac[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC2, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCE, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD4, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DE_MAC)
+inline constexpr hid_locale_t locale_de_mac {
+    ascii_de_mac, sizeof(ascii_de_mac) / 3,
+    utf8_de_mac, sizeof(utf8_de_mac) / 4,
+    combinations_de_mac, sizeof(combinations_de_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DK_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_dk_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x24, KEY_NONE,               KEY_GRAVE,          // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_MINUS,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_BACKSLASH,      // @
+    0x5B, KEY_MOD_LALT,           KEY_8,              // [
+    0x5C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // bslash
+    0x5D, KEY_MOD_LALT,           KEY_9,              // ]
+    0x5E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // {
+    0x7C, KEY_MOD_LALT,           KEY_I,              // |
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // }
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DK_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_dk_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_4,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_A,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_H,              // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ¯
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_Q,              // °
+    0xB1, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, KEY_MOD_LALT,           KEY_DOT,            // ·
+    0xB8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ¸
+    0xBA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Á
+    0xC2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // Â
+    0xC4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ä
+    0xC5, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Å
+    0xC6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // É
+    0xCA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Ê
+    0xCB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // Ë
+    0xD1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // Ñ
+    0xD6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Ö
+    0xD8, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ø
+    0xDC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ü
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // ä
+    0xE5, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // å
+    0xE6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xE9, 0x00, KEY_MOD_LALT,           KEY_E,              // é
+    0xF1, 0x00, KEY_MOD_LALT,           KEY_N,              // ñ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // ö
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ÷
+    0xF8, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ø
+    0xFC, 0x00, KEY_MOD_LALT,           KEY_U,              // ü
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_O,              // œ
+    0x78, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Ÿ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ˘
+    0xD9, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_2,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ‡
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_X,              // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_J,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ⁄
+    0xAC, 0x20, KEY_MOD_LSHIFT,         KEY_4,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_6,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_K,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, KEY_MOD_LALT,           KEY_GRAVE,          // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DK_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_dk_mac[] = {
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // â
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // û
+    0xFD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DK_MAC)
+inline constexpr hid_locale_t locale_dk_mac {
+    ascii_dk_mac, sizeof(ascii_dk_mac) / 3,
+    utf8_dk_mac, sizeof(utf8_dk_mac) / 4,
+    combinations_dk_mac, sizeof(combinations_dk_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_EE_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ee_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x24, KEY_MOD_LALT,           KEY_4,              // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_MINUS,          // +
+    0x2C, KEY_NONE,               KEY_NONE,           // ,
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_NONE,           // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x5B, KEY_MOD_LALT,           KEY_8,              // [
+    0x5C, KEY_MOD_LALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_9,              // ]
+    0x5E, KEY_MOD_LALT,           KEY_APOSTROPHE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_LALT,           KEY_EQUAL,          // `
+    0x7B, KEY_MOD_LALT,           KEY_7,              // {
+    0x7C, KEY_MOD_LALT,           KEY_102ND,          // |
+    0x7D, KEY_MOD_LALT,           KEY_0,              // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_EE_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ee_mac[] = {
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA7, 0x00, KEY_MOD_LALT,           KEY_6,              // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_1,              // ©
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // °
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // ¶
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // »
+    0xBD, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // ½
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ä
+    0xD5, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ö
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ü
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_L,              // ß
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xF5, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // õ
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ÷
+    0xFC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ü
+    0x0C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Č
+    0x0D, 0x01, KEY_MOD_LALT,           KEY_C,              // č
+    0x50, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ő
+    0x51, 0x01, KEY_MOD_LALT,           KEY_SEMICOLON,      // ő
+    0x60, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Š
+    0x61, 0x01, KEY_MOD_LALT,           KEY_S,              // š
+    0x70, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // Ű
+    0x7D, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Ž
+    0x7E, 0x01, KEY_MOD_LALT,           KEY_Z,              // ž
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ˇ
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_M,              // ‘
+    0x19, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_N,              // ‚
+    0x1C, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_Q,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x39, 0x20, KEY_MOD_LALT,           KEY_V,              // ‹
+    0x3A, 0x20, KEY_MOD_LALT,           KEY_B,              // ›
+    0xAC, 0x20, KEY_MOD_LSHIFT,         KEY_4,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x11, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_J,              // √
+    0x60, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≠
+    0x64, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A               // ◊
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_EE_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ee_mac[] = {
+    0x7E, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // é
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0x04, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_A,              // ą
+    0x06, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_C,              // ć
+    0x16, 0x01, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ė
+    0x17, 0x01, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ė
+    0x18, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_E,              // ę
+    0x1A, 0x01, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_E,              // ě
+    0x2E, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_I,              // Į
+    0x2F, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_I,              // į
+    0x43, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_N,              // ń
+    0x47, 0x01, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_N,              // ň
+    0x5A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_S,              // ś
+    0x6E, 0x01, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ů
+    0x6F, 0x01, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ů
+    0x72, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Ų
+    0x73, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_U,              // ų
+    0x79, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Z,              // Ź
+    0x7A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Z,              // ź
+    0x7B, 0x01, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Z,              // Ż
+    0x7C, 0x01, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_Z,              // ż
+    0xF8, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ǹ
+    0xF9, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_N               // ǹ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_EE_MAC)
+inline constexpr hid_locale_t locale_ee_mac {
+    ascii_ee_mac, sizeof(ascii_ee_mac) / 3,
+    utf8_ee_mac, sizeof(utf8_ee_mac) / 4,
+    combinations_ee_mac, sizeof(combinations_ee_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_es_la_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_NONE,               KEY_RIGHTBRACE,     // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_Q,              // @
+    0x5B, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // [
+    0x5C, KEY_MOD_LALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // ]
+    0x5E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // `
+    0x7B, KEY_NONE,               KEY_APOSTROPHE,     // {
+    0x7C, KEY_NONE,               KEY_GRAVE,          // |
+    0x7D, KEY_NONE,               KEY_BACKSLASH,      // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_es_la_mac[] = {
+    0xA1, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_MOD_LALT,           KEY_6,              // §
+    0xA8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ¨
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_9,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_0,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // »
+    0xBF, 0x00, KEY_NONE,               KEY_EQUAL,          // ¿
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xD1, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ñ
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF1, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ñ
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x30, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // İ
+    0x31, 0x01, KEY_MOD_LALT,           KEY_I,              // ı
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xBB, 0x03, KEY_MOD_LALT,           KEY_L,              // λ
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ’
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_2,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K               // 
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_es_la_mac[] = {
+    0x7E, 0x00, KEY_MOD_LALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ~
+    0xB4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE0, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U               // ü
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA_MAC)
+inline constexpr hid_locale_t locale_es_la_mac {
+    ascii_es_la_mac, sizeof(ascii_es_la_mac) / 3,
+    utf8_es_la_mac, sizeof(utf8_es_la_mac) / 4,
+    combinations_es_la_mac, sizeof(combinations_es_la_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_es_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_LALT,           KEY_3,              // #
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_NONE,               KEY_RIGHTBRACE,     // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x5B, KEY_MOD_LALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_MOD_LALT,           KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_LALT,           KEY_APOSTROPHE,     // {
+    0x7C, KEY_MOD_LALT,           KEY_1,              // |
+    0x7D, KEY_MOD_LALT,           KEY_BACKSLASH,      // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_es_mac[] = {
+    0xA0, 0x00, KEY_MOD_LALT,           KEY_SPACE,
+    0xA1, 0x00, KEY_NONE,               KEY_EQUAL,          // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_MOD_LALT,           KEY_K,              // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_C,              // ©
+    0xAA, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ª
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_6,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ±
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ´
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_J,              // ¶
+    0xB7, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // ·
+    0xB8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¸
+    0xBA, 0x00, KEY_NONE,               KEY_GRAVE,          // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xBF, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          // ¿
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Æ
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ç
+    0xD1, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ñ
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_B,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_W,              // æ
+    0xE7, 0x00, KEY_NONE,               KEY_BACKSLASH,      // ç
+    0xF1, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ñ
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_7,              // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ˆ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // ˘
+    0xD9, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_EQUAL,          // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_8,              // “
+    0x1D, 0x20, KEY_MOD_LALT,           KEY_9,              // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ‡
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_H,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_X,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_S,              // ∫
+    0x48, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, KEY_MOD_LALT,           KEY_G,              // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_es_mac[] = {
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xC0, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE0, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ü
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_Y,              // ÿ
+    0x78, 0x01, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Y               // Ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_MAC)
+inline constexpr hid_locale_t locale_es_mac {
+    ascii_es_mac, sizeof(ascii_es_mac) / 3,
+    utf8_es_mac, sizeof(utf8_es_mac) / 4,
+    combinations_es_mac, sizeof(combinations_es_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FI_MAC) || defined(LOCALE_SE_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_fi_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x24, KEY_MOD_LALT,           KEY_4,              // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_MINUS,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x5B, KEY_MOD_LALT,           KEY_8,              // [
+    0x5C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // bslash
+    0x5D, KEY_MOD_LALT,           KEY_9,              // ]
+    0x5E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // `
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // {
+    0x7C, KEY_MOD_LALT,           KEY_7,              // |
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // }
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FI_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_fi_mac[] = {
+    0xA1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ¡
+    0xA2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_1,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_K,              // ª
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ¯
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xB1, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ±
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          // ´
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_Y,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ·
+    0xB8, 0x00, KEY_MOD_LALT,           KEY_G,              // ¸
+    0xBA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¿
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ä
+    0xC5, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // É
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ö
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ø
+    0xDC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ü
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xE5, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xE9, 0x00, KEY_MOD_LALT,           KEY_E,              // é
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_Z,              // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // ø
+    0xFC, 0x00, KEY_MOD_LALT,           KEY_U,              // ü
+    0x31, 0x01, KEY_MOD_LALT,           KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_O,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ˆ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // ˘
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_LEFTBRACE,      // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ˚
+    0xDB, 0x02, KEY_MOD_LALT,           KEY_H,              // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_W,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_N,              // ‘
+    0x19, 0x20, KEY_MOD_LALT,           KEY_M,              // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // ‚
+    0x1C, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_Q,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_V,              // ‹
+    0x3A, 0x20, KEY_MOD_LALT,           KEY_B,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ⁄
+    0xAC, 0x20, KEY_MOD_LSHIFT,         KEY_4,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_BACKSLASH,      // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_J,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_0,              // ≈
+    0x60, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // ◊
+    0xFF, 0xF8, KEY_MOD_LALT,           KEY_A,              // 
+    0x01, 0xFB, KEY_MOD_LALT,           KEY_L,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FI_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_fi_mac[] = {
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // â
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // û
+    0xFF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_Y,              // ÿ
+    0x78, 0x01, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_Y               // Ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FI_MAC)
+inline constexpr hid_locale_t locale_fi_mac {
+    ascii_fi_mac, sizeof(ascii_fi_mac) / 3,
+    utf8_fi_mac, sizeof(utf8_fi_mac) / 4,
+    combinations_fi_mac, sizeof(combinations_fi_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FR_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_fr_mac[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ^
+    0x7E, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_Q,              // À
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_Q,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Q,              // Ä
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_Q,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_Q,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_Q,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Q,              // ä
+    0xEC, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_I,              // í
+    0xF2, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_O,              // ó
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xFA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U               // ü
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FR_MAC)
+inline constexpr hid_locale_t locale_fr_mac {
+    ascii_be_mac, sizeof(ascii_be_mac) / 3,
+    utf8_be_mac, sizeof(utf8_be_mac) / 4,
+    combinations_fr_mac, sizeof(combinations_fr_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GB_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_gb_mac[] = {
+    0x23, KEY_MOD_LALT,           KEY_3,              // #
+    0x60, KEY_NONE,               KEY_102ND,          // `
+    0x7E, KEY_MOD_LSHIFT,         KEY_102ND           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GB_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_gb_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_9,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB1, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_0,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Á
+    0xC2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // Â
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xC8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // È
+    0xCA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Ê
+    0xCB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ë
+    0xCC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ì
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Î
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xD9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // Ù
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ú
+    0xDB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Û
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x78, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // Ÿ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˆ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ˘
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_H,              // ˙
+    0xDA, 0x02, KEY_MOD_LALT,           KEY_K,              // ˚
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ˜
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_2,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GB_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_gb_mac[] = {
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xE0, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_I,              // í
+    0xEF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_U,              // û
+    0xFF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GB_MAC)
+inline constexpr hid_locale_t locale_gb_mac {
+    ascii_gb_mac, sizeof(ascii_gb_mac) / 3,
+    utf8_gb_mac, sizeof(utf8_gb_mac) / 4,
+    combinations_gb_mac, sizeof(combinations_gb_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GR_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_gr_mac[] = {
+    0x27, KEY_NONE,               KEY_NONE,           // '
+    0x3A, KEY_MOD_LSHIFT,         KEY_Q,              // :
+    0x3B, KEY_NONE,               KEY_Q,              // ;
+    0x41, KEY_NONE,               KEY_NONE,           // A
+    0x42, KEY_NONE,               KEY_NONE,           // B
+    0x43, KEY_NONE,               KEY_NONE,           // C
+    0x44, KEY_NONE,               KEY_NONE,           // D
+    0x45, KEY_NONE,               KEY_NONE,           // E
+    0x46, KEY_NONE,               KEY_NONE,           // F
+    0x47, KEY_NONE,               KEY_NONE,           // G
+    0x48, KEY_NONE,               KEY_NONE,           // H
+    0x49, KEY_NONE,               KEY_NONE,           // I
+    0x4A, KEY_NONE,               KEY_NONE,           // J
+    0x4B, KEY_NONE,               KEY_NONE,           // K
+    0x4C, KEY_NONE,               KEY_NONE,           // L
+    0x4D, KEY_NONE,               KEY_NONE,           // M
+    0x4E, KEY_NONE,               KEY_NONE,           // N
+    0x4F, KEY_NONE,               KEY_NONE,           // O
+    0x50, KEY_NONE,               KEY_NONE,           // P
+    0x51, KEY_NONE,               KEY_NONE,           // Q
+    0x52, KEY_NONE,               KEY_NONE,           // R
+    0x53, KEY_NONE,               KEY_NONE,           // S
+    0x54, KEY_NONE,               KEY_NONE,           // T
+    0x55, KEY_NONE,               KEY_NONE,           // U
+    0x56, KEY_NONE,               KEY_NONE,           // V
+    0x57, KEY_NONE,               KEY_NONE,           // W
+    0x58, KEY_NONE,               KEY_NONE,           // X
+    0x59, KEY_NONE,               KEY_NONE,           // Y
+    0x5A, KEY_NONE,               KEY_NONE,           // Z
+    0x60, KEY_NONE,               KEY_102ND,          // `
+    0x61, KEY_NONE,               KEY_NONE,           // a
+    0x62, KEY_NONE,               KEY_NONE,           // b
+    0x63, KEY_NONE,               KEY_NONE,           // c
+    0x64, KEY_NONE,               KEY_NONE,           // d
+    0x65, KEY_NONE,               KEY_NONE,           // e
+    0x66, KEY_NONE,               KEY_NONE,           // f
+    0x67, KEY_NONE,               KEY_NONE,           // g
+    0x68, KEY_NONE,               KEY_NONE,           // h
+    0x69, KEY_NONE,               KEY_NONE,           // i
+    0x6A, KEY_NONE,               KEY_NONE,           // j
+    0x6B, KEY_NONE,               KEY_NONE,           // k
+    0x6C, KEY_NONE,               KEY_NONE,           // l
+    0x6D, KEY_NONE,               KEY_NONE,           // m
+    0x6E, KEY_NONE,               KEY_NONE,           // n
+    0x6F, KEY_NONE,               KEY_NONE,           // o
+    0x70, KEY_NONE,               KEY_NONE,           // p
+    0x71, KEY_NONE,               KEY_NONE,           // q
+    0x72, KEY_NONE,               KEY_NONE,           // r
+    0x73, KEY_NONE,               KEY_NONE,           // s
+    0x74, KEY_NONE,               KEY_NONE,           // t
+    0x75, KEY_NONE,               KEY_NONE,           // u
+    0x76, KEY_NONE,               KEY_NONE,           // v
+    0x77, KEY_NONE,               KEY_NONE,           // w
+    0x78, KEY_NONE,               KEY_NONE,           // x
+    0x79, KEY_NONE,               KEY_NONE,           // y
+    0x7A, KEY_NONE,               KEY_NONE,           // z
+    0x7E, KEY_MOD_LSHIFT,         KEY_102ND           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GR_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_gr_mac[] = {
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_4,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA6, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // ¦
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAD, 0x00, KEY_MOD_LALT,           KEY_U,              // ­
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_7,              // °
+    0xB1, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ±
+    0xB2, 0x00, KEY_MOD_LALT,           KEY_2,              // ²
+    0xB3, 0x00, KEY_MOD_LALT,           KEY_3,              // ³
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_6,              // ¶
+    0xB7, 0x00, KEY_MOD_LALT,           KEY_Q,              // ·
+    0xB9, 0x00, KEY_MOD_LALT,           KEY_1,              // ¹
+    0xBB, 0x00, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // »
+    0xBD, 0x00, KEY_MOD_LALT,           KEY_H,              // ½
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_D,              // ÷
+    0x53, 0x01, KEY_MOD_LALT,           KEY_O,              // œ
+    0x86, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // Ά
+    0x88, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Έ
+    0x8C, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // Ό
+    0x8E, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // Ύ
+    0x8F, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // Ώ
+    0x91, 0x03, KEY_MOD_LSHIFT,         KEY_A,              // Α
+    0x92, 0x03, KEY_MOD_LSHIFT,         KEY_B,              // Β
+    0x93, 0x03, KEY_MOD_LSHIFT,         KEY_G,              // Γ
+    0x94, 0x03, KEY_MOD_LSHIFT,         KEY_D,              // Δ
+    0x95, 0x03, KEY_MOD_LSHIFT,         KEY_E,              // Ε
+    0x96, 0x03, KEY_MOD_LSHIFT,         KEY_Z,              // Ζ
+    0x97, 0x03, KEY_MOD_LSHIFT,         KEY_H,              // Η
+    0x98, 0x03, KEY_MOD_LSHIFT,         KEY_U,              // Θ
+    0x99, 0x03, KEY_MOD_LSHIFT,         KEY_I,              // Ι
+    0x9A, 0x03, KEY_MOD_LSHIFT,         KEY_K,              // Κ
+    0x9B, 0x03, KEY_MOD_LSHIFT,         KEY_L,              // Λ
+    0x9C, 0x03, KEY_MOD_LSHIFT,         KEY_M,              // Μ
+    0x9D, 0x03, KEY_MOD_LSHIFT,         KEY_N,              // Ν
+    0x9E, 0x03, KEY_MOD_LSHIFT,         KEY_J,              // Ξ
+    0x9F, 0x03, KEY_MOD_LSHIFT,         KEY_O,              // Ο
+    0xA0, 0x03, KEY_MOD_LSHIFT,         KEY_P,              // Π
+    0xA1, 0x03, KEY_MOD_LSHIFT,         KEY_R,              // Ρ
+    0xA3, 0x03, KEY_MOD_LSHIFT,         KEY_S,              // Σ
+    0xA4, 0x03, KEY_MOD_LSHIFT,         KEY_T,              // Τ
+    0xA5, 0x03, KEY_MOD_LSHIFT,         KEY_Y,              // Υ
+    0xA6, 0x03, KEY_MOD_LSHIFT,         KEY_F,              // Φ
+    0xA7, 0x03, KEY_MOD_LSHIFT,         KEY_X,              // Χ
+    0xA8, 0x03, KEY_MOD_LSHIFT,         KEY_C,              // Ψ
+    0xA9, 0x03, KEY_MOD_LSHIFT,         KEY_V,              // Ω
+    0xAA, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ϊ
+    0xAC, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // ά
+    0xAD, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // έ
+    0xAE, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ή
+    0xAF, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ί
+    0xB1, 0x03, KEY_NONE,               KEY_A,              // α
+    0xB2, 0x03, KEY_NONE,               KEY_B,              // β
+    0xB3, 0x03, KEY_NONE,               KEY_G,              // γ
+    0xB4, 0x03, KEY_NONE,               KEY_D,              // δ
+    0xB5, 0x03, KEY_NONE,               KEY_E,              // ε
+    0xB6, 0x03, KEY_NONE,               KEY_Z,              // ζ
+    0xB7, 0x03, KEY_NONE,               KEY_H,              // η
+    0xB8, 0x03, KEY_NONE,               KEY_U,              // θ
+    0xB9, 0x03, KEY_NONE,               KEY_I,              // ι
+    0xBA, 0x03, KEY_NONE,               KEY_K,              // κ
+    0xBB, 0x03, KEY_NONE,               KEY_L,              // λ
+    0xBC, 0x03, KEY_NONE,               KEY_M,              // μ
+    0xBD, 0x03, KEY_NONE,               KEY_N,              // ν
+    0xBE, 0x03, KEY_NONE,               KEY_J,              // ξ
+    0xBF, 0x03, KEY_NONE,               KEY_O,              // ο
+    0xC0, 0x03, KEY_NONE,               KEY_P,              // π
+    0xC1, 0x03, KEY_NONE,               KEY_R,              // ρ
+    0xC2, 0x03, KEY_NONE,               KEY_W,              // ς
+    0xC3, 0x03, KEY_NONE,               KEY_S,              // σ
+    0xC4, 0x03, KEY_NONE,               KEY_T,              // τ
+    0xC5, 0x03, KEY_NONE,               KEY_Y,              // υ
+    0xC6, 0x03, KEY_NONE,               KEY_F,              // φ
+    0xC7, 0x03, KEY_NONE,               KEY_X,              // χ
+    0xC8, 0x03, KEY_NONE,               KEY_C,              // ψ
+    0xC9, 0x03, KEY_NONE,               KEY_V,              // ω
+    0xCC, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ό
+    0xCD, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ύ
+    0xCE, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ώ
+    0x15, 0x20, KEY_MOD_LALT,           KEY_W,              // ―
+    0x18, 0x20, KEY_MOD_LALT,           KEY_N,              // ‘
+    0x19, 0x20, KEY_MOD_LALT,           KEY_M,              // ’
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_9,              // “
+    0x20, 0x20, KEY_MOD_LALT,           KEY_I,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_A,              // …
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_T,              // ™
+    0x48, 0x22, KEY_MOD_LALT,           KEY_P,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_F,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_J,              // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_K               // ≥
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GR_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_gr_mac[] = {
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE,          // ¨
+    0x84, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE,          // ΄
+    0x85, 0x03, KEY_MOD_LSHIFT,         KEY_W,              KEY_NONE,               KEY_SPACE,          // ΅
+    0x89, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_H,              // Ή
+    0x8A, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_I,              // Ί
+    0x90, 0x03, KEY_MOD_LSHIFT,         KEY_W,              KEY_NONE,               KEY_I,              // ΐ
+    0xAB, 0x03, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_Y,              // Ϋ
+    0xB0, 0x03, KEY_MOD_LSHIFT,         KEY_W,              KEY_NONE,               KEY_Y,              // ΰ
+    0xCA, 0x03, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_NONE,               KEY_I,              // ϊ
+    0xCB, 0x03, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_NONE,               KEY_Y               // ϋ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GR_MAC)
+inline constexpr hid_locale_t locale_gr_mac {
+    ascii_gr_mac, sizeof(ascii_gr_mac) / 3,
+    utf8_gr_mac, sizeof(utf8_gr_mac) / 4,
+    combinations_gr_mac, sizeof(combinations_gr_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HR_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_hr_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_7,              // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_EQUAL,          // *
+    0x2B, KEY_NONE,               KEY_EQUAL,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_NONE,               KEY_MINUS,          // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_GRAVE,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_GRAVE,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x5B, KEY_MOD_LALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_MOD_LALT,           KEY_BACKSLASH,      // bslash
+    0x5D, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_MOD_LALT,           KEY_APOSTROPHE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // {
+    0x7C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // |
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // }
+    0x7E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HR_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_hr_mac[] = {
+    0xA0, 0x00, KEY_MOD_LALT,           KEY_SPACE,
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA7, 0x00, KEY_MOD_LALT,           KEY_6,              // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_9,              // ª
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_0,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¿
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xC8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // È
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // É
+    0xCC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ì
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Î
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // Ñ
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x06, 0x01, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ć
+    0x07, 0x01, KEY_NONE,               KEY_APOSTROPHE,     // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Č
+    0x0D, 0x01, KEY_NONE,               KEY_SEMICOLON,      // č
+    0x10, 0x01, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Đ
+    0x11, 0x01, KEY_NONE,               KEY_RIGHTBRACE,     // đ
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Š
+    0x61, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // š
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ž
+    0x7E, 0x01, KEY_NONE,               KEY_BACKSLASH,      // ž
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˆ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ˇ
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, KEY_MOD_LALT,           KEY_Y,              // —
+    0x18, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, KEY_NONE,               KEY_102ND,          // “
+    0x1D, 0x20, KEY_MOD_LSHIFT,         KEY_102ND,          // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_102ND,          // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_4,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K               // 
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HR_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_hr_mac[] = {
+    0x60, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          KEY_NONE,               KEY_SPACE,          // `
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xCA, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE0, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_I,              // í
+    0xEF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HR_MAC)
+inline constexpr hid_locale_t locale_hr_mac {
+    ascii_hr_mac, sizeof(ascii_hr_mac) / 3,
+    utf8_hr_mac, sizeof(utf8_hr_mac) / 4,
+    combinations_hr_mac, sizeof(combinations_hr_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HU_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_hu_mac[] = {
+    0x21, KEY_MOD_LSHIFT,         KEY_4,              // !
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // #
+    0x24, KEY_MOD_LALT,           KEY_4,              // $
+    0x26, KEY_MOD_LALT,           KEY_1,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_1,              // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_3,              // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_6,              // /
+    0x30, KEY_NONE,               KEY_GRAVE,          // 0
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LALT,           KEY_DOT,            // ;
+    0x3C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_7,              // =
+    0x3E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_COMMA,          // ?
+    0x40, KEY_MOD_LALT,           KEY_Q,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_LALT,           KEY_8,              // [
+    0x5C, KEY_MOD_LALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_9,              // ]
+    0x5E, KEY_MOD_LALT,           KEY_APOSTROPHE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_LALT,           KEY_BACKSLASH,      // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_LALT,           KEY_7,              // {
+    0x7C, KEY_MOD_LALT,           KEY_102ND,          // |
+    0x7D, KEY_MOD_LALT,           KEY_0,              // }
+    0x7E, KEY_MOD_LALT,           KEY_RIGHTBRACE      // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HU_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_hu_mac[] = {
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // §
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      // ¨
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_Z,              // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // ¬
+    0xAE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ®
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // °
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_R,              // ¶
+    0xBB, 0x00, KEY_MOD_LALT,           KEY_X,              // »
+    0xC1, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Á
+    0xC9, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // É
+    0xCD, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          // Í
+    0xD3, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xD5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_0,              // Ö
+    0xDA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ú
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_MINUS,          // Ü
+    0xDD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // Ý
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // á
+    0xE9, 0x00, KEY_NONE,               KEY_SEMICOLON,      // é
+    0xED, 0x00, KEY_NONE,               KEY_102ND,          // í
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          // ó
+    0xF6, 0x00, KEY_NONE,               KEY_0,              // ö
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ÷
+    0xFA, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ú
+    0xFC, 0x00, KEY_NONE,               KEY_MINUS,          // ü
+    0xFD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ý
+    0x04, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_LALT,           KEY_A,              // ą
+    0x07, 0x01, KEY_MOD_LALT,           KEY_C,              // ć
+    0x19, 0x01, KEY_MOD_LALT,           KEY_W,              // ę
+    0x22, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // Ģ
+    0x2A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // Ī
+    0x2B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ī
+    0x2E, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Į
+    0x36, 0x01, KEY_MOD_LALT,           KEY_M,              // Ķ
+    0x37, 0x01, KEY_MOD_LALT,           KEY_H,              // ķ
+    0x3B, 0x01, KEY_MOD_LALT,           KEY_P,              // Ļ
+    0x3C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // ļ
+    0x41, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Ł
+    0x42, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ł
+    0x44, 0x01, KEY_MOD_LALT,           KEY_F,              // ń
+    0x45, 0x01, KEY_MOD_LALT,           KEY_O,              // Ņ
+    0x4D, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // ō
+    0x50, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ő
+    0x51, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // ő
+    0x54, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // Ŕ
+    0x55, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ŕ
+    0x56, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // Ŗ
+    0x57, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ŗ
+    0x58, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // Ř
+    0x59, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ř
+    0x5B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ś
+    0x61, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // š
+    0x65, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ť
+    0x6A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ū
+    0x6E, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ů
+    0x70, 0x01, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ű
+    0x71, 0x01, KEY_NONE,               KEY_BACKSLASH,      // ű
+    0x72, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // Ų
+    0x73, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ų
+    0x79, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Ź
+    0x7A, 0x01, KEY_MOD_LALT,           KEY_Y,              // ź
+    0x7B, 0x01, KEY_MOD_LALT,           KEY_K,              // Ż
+    0x7C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ż
+    0x7D, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Ž
+    0x7E, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ž
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ‚
+    0x1D, 0x20, KEY_MOD_LALT,           KEY_B,              // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_V,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_L,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x39, 0x20, KEY_MOD_LALT,           KEY_5,              // ‹
+    0x3A, 0x20, KEY_MOD_LALT,           KEY_6,              // ›
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL           // ≠
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HU_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_hu_mac[] = {
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0x0C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0D, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_NONE,               KEY_C,              // č
+    0x1A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ě
+    0x47, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_NONE,               KEY_N,              // ň
+    0x60, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_S,              // Š
+    0x64, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE           // ˇ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HU_MAC)
+inline constexpr hid_locale_t locale_hu_mac {
+    ascii_hu_mac, sizeof(ascii_hu_mac) / 3,
+    utf8_hu_mac, sizeof(utf8_hu_mac) / 4,
+    combinations_hu_mac, sizeof(combinations_hu_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IN_MAC) || defined(LOCALE_NL_MAC) || defined(LOCALE_PL_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_in_mac[] = {
+    0x60, KEY_NONE,               KEY_102ND,          // `
+    0x7E, KEY_MOD_LSHIFT,         KEY_102ND           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IN_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_in_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_V,              // ¨
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // «
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_0,              // °
+    0xB1, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ±
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ¿
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xD0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Ð
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xDE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Þ
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xFE, 0x00, KEY_MOD_LALT,           KEY_T,              // þ
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xCD, 0x02, KEY_MOD_LALT,           KEY_I,              // ˍ
+    0xD8, 0x02, KEY_MOD_LALT,           KEY_C,              // ˘
+    0x00, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ̀
+    0x01, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ́
+    0x02, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ̂
+    0x03, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ̃
+    0x04, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // ̄
+    0x06, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ̆
+    0x07, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // ̇
+    0x08, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ̈
+    0x09, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ̉
+    0x0A, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ̊
+    0x0B, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ̋
+    0x0C, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ̌
+    0x10, 0x03, KEY_MOD_LALT,           KEY_9,              // ̐
+    0x1B, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ̛
+    0x23, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ̣
+    0x26, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ̦
+    0x27, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // ̧
+    0x28, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ̨
+    0x30, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ̰
+    0x35, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // ̵
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // „
+    0x20, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ⁄
+    0xAC, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // €
+    0xB9, 0x20, KEY_MOD_LALT,           KEY_4,              // ₹
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT             // ≥
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IN_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_in_mac[] = {
+    0xAF, 0x00, KEY_MOD_LALT,           KEY_A,              KEY_NONE,               KEY_SPACE,          // ¯
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_SPACE,          // ´
+    0xB8, 0x00, KEY_MOD_LALT,           KEY_C,              KEY_NONE,               KEY_SPACE,          // ¸
+    0x94, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            KEY_NONE,               KEY_SPACE,          // ʔ
+    0xC0, 0x02, KEY_MOD_LALT,           KEY_Z,              KEY_NONE,               KEY_SPACE,          // ˀ
+    0xC6, 0x02, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_SPACE,          // ˆ
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_W,              KEY_NONE,               KEY_SPACE,          // ˙
+    0xDA, 0x02, KEY_MOD_LALT,           KEY_K,              KEY_NONE,               KEY_SPACE,          // ˚
+    0xDB, 0x02, KEY_MOD_LALT,           KEY_M,              KEY_NONE,               KEY_SPACE,          // ˛
+    0xDC, 0x02, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_SPACE,          // ˜
+    0xDD, 0x02, KEY_MOD_LALT,           KEY_J,              KEY_NONE,               KEY_SPACE,          // ˝
+    0xF3, 0x02, KEY_MOD_LALT,           KEY_R,              KEY_NONE,               KEY_SPACE,          // ˳
+    0x16, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE           // №
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IN_MAC)
+inline constexpr hid_locale_t locale_in_mac {
+    ascii_in_mac, sizeof(ascii_in_mac) / 3,
+    utf8_in_mac, sizeof(utf8_in_mac) / 4,
+    combinations_in_mac, sizeof(combinations_in_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IS_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_is_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_RIGHTBRACE,     // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_BACKSLASH,      // +
+    0x2C, KEY_NONE,               KEY_NONE,           // ,
+    0x2D, KEY_NONE,               KEY_EQUAL,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_NONE,           // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x5B, KEY_MOD_LALT,           KEY_8,              // [
+    0x5C, KEY_MOD_LALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_9,              // ]
+    0x5E, KEY_MOD_LALT,           KEY_6,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_EQUAL,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_LALT,           KEY_7,              // {
+    0x7C, KEY_MOD_LALT,           KEY_H,              // |
+    0x7D, KEY_MOD_LALT,           KEY_0,              // }
+    0x7E, KEY_MOD_LALT,           KEY_X               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IS_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_is_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ª
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_K,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ¯
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_T,              // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ·
+    0xB8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // ¸
+    0xBA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ¿
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xD0, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ð
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_MINUS,          // Ö
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // Ø
+    0xDE, 0x00, KEY_MOD_LSHIFT,         KEY_SLASH,          // Þ
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF0, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ð
+    0xF6, 0x00, KEY_NONE,               KEY_MINUS,          // ö
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // ø
+    0xFE, 0x00, KEY_NONE,               KEY_SLASH,          // þ
+    0x31, 0x01, KEY_MOD_LALT,           KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ˘
+    0xD9, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ˛
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0x13, 0x20, KEY_MOD_LALT,           KEY_EQUAL,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // —
+    0x18, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // ‘
+    0x19, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // ’
+    0x1C, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // „
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_L,              // …
+    0x30, 0x20, KEY_MOD_LALT,           KEY_5,              // ‰
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_3,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≈
+    0x60, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND           // 
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IS_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_is_mac[] = {
+    0x60, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_SPACE,          // `
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LALT,           KEY_O,              KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LALT,           KEY_O,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LALT,           KEY_O,              KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD9, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LALT,           KEY_O,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LALT,           KEY_O,              KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_O,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LALT,           KEY_O,              KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ó
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF9, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_O,              KEY_NONE,               KEY_U,              // û
+    0xFD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_Y,              // ÿ
+    0x78, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_Y,              // Ÿ
+    0xC6, 0x02, KEY_MOD_LALT,           KEY_O,              KEY_NONE,               KEY_SPACE,          // ˆ
+    0xDC, 0x02, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_SPACE           // ˜
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IS_MAC)
+inline constexpr hid_locale_t locale_is_mac {
+    ascii_is_mac, sizeof(ascii_is_mac) / 3,
+    utf8_is_mac, sizeof(utf8_is_mac) / 4,
+    combinations_is_mac, sizeof(combinations_is_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IT_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_it_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_LALT,           KEY_APOSTROPHE,     // #
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_NONE,               KEY_RIGHTBRACE,     // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_SEMICOLON,      // @
+    0x5B, KEY_MOD_LALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_NONE,               KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_MOD_LSHIFT,         KEY_EQUAL,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_LALT,           KEY_GRAVE,          // `
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_GRAVE,          // |
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // }
+    0x7E, KEY_MOD_LALT,           KEY_5               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IT_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_it_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ¡
+    0xA2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_4,              // ¥
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_C,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_J,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_1,              // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ¯
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ·
+    0xB8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // ¸
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_K,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¿
+    0xC0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // À
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Á
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ç
+    0xC8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // È
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // É
+    0xCC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // Ì
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // Í
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // Ó
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xD9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ù
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // Ú
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE0, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // à
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_Y,              // æ
+    0xE7, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // ç
+    0xE8, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // è
+    0xE9, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // é
+    0xEC, 0x00, KEY_NONE,               KEY_EQUAL,          // ì
+    0xF2, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ò
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_7,              // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0xF9, 0x00, KEY_NONE,               KEY_BACKSLASH,      // ù
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_I,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ˘
+    0xD9, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ˛
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_W,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_3,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_2,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_Q,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_X,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_DOT,            // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_6,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_T,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_H,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_Z,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_G,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8               // 
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IT_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_it_mac[] = {
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_SPACE,          // ´
+    0xC2, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xCA, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCE, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD4, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDB, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // ë
+    0xED, 0x00, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ï
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_O,              // ö
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_U,              // û
+    0xFF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_Y,              // ÿ
+    0x78, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_Y,              // Ÿ
+    0xC6, 0x02, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ˆ
+    0xDC, 0x02, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_SPACE           // ˜
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IT_MAC)
+inline constexpr hid_locale_t locale_it_mac {
+    ascii_it_mac, sizeof(ascii_it_mac) / 3,
+    utf8_it_mac, sizeof(utf8_it_mac) / 4,
+    combinations_it_mac, sizeof(combinations_it_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LT_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_lt_mac[] = {
+    0x21, KEY_NONE,               KEY_NONE,           // !
+    0x23, KEY_NONE,               KEY_NONE,           // #
+    0x24, KEY_NONE,               KEY_NONE,           // $
+    0x25, KEY_NONE,               KEY_NONE,           // %
+    0x26, KEY_NONE,               KEY_NONE,           // &
+    0x2A, KEY_NONE,               KEY_NONE,           // *
+    0x2B, KEY_NONE,               KEY_NONE,           // +
+    0x31, KEY_NONE,               KEY_NONE,           // 1
+    0x32, KEY_NONE,               KEY_NONE,           // 2
+    0x33, KEY_NONE,               KEY_NONE,           // 3
+    0x34, KEY_NONE,               KEY_NONE,           // 4
+    0x35, KEY_NONE,               KEY_NONE,           // 5
+    0x36, KEY_NONE,               KEY_NONE,           // 6
+    0x37, KEY_NONE,               KEY_NONE,           // 7
+    0x38, KEY_NONE,               KEY_NONE,           // 8
+    0x3D, KEY_NONE,               KEY_NONE,           // =
+    0x40, KEY_NONE,               KEY_NONE,           // @
+    0x5E, KEY_NONE,               KEY_NONE,           // ^
+    0x60, KEY_NONE,               KEY_RO,             // `
+    0x7E, KEY_MOD_LSHIFT,         KEY_102ND           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LT_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_lt_mac[] = {
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ¨
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Á
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ú
+    0xDD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // Ý
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xFD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ý
+    0x00, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Ā
+    0x01, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // ā
+    0x04, 0x01, KEY_MOD_LSHIFT,         KEY_1,              // Ą
+    0x05, 0x01, KEY_NONE,               KEY_1,              // ą
+    0x06, 0x01, KEY_MOD_LALT,           KEY_A,              // Ć
+    0x07, 0x01, KEY_MOD_LALT,           KEY_C,              // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_2,              // Č
+    0x0D, 0x01, KEY_NONE,               KEY_2,              // č
+    0x16, 0x01, KEY_MOD_LSHIFT,         KEY_4,              // Ė
+    0x17, 0x01, KEY_NONE,               KEY_4,              // ė
+    0x18, 0x01, KEY_MOD_LSHIFT,         KEY_3,              // Ę
+    0x19, 0x01, KEY_NONE,               KEY_3,              // ę
+    0x22, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // Ģ
+    0x23, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // ģ
+    0x2A, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          // Ī
+    0x2B, 0x01, KEY_MOD_LALT,           KEY_Y,              // ī
+    0x2E, 0x01, KEY_MOD_LSHIFT,         KEY_5,              // Į
+    0x2F, 0x01, KEY_NONE,               KEY_5,              // į
+    0x36, 0x01, KEY_MOD_LALT,           KEY_M,              // Ķ
+    0x37, 0x01, KEY_MOD_LALT,           KEY_H,              // ķ
+    0x39, 0x01, KEY_MOD_LALT,           KEY_Z,              // Ĺ
+    0x3A, 0x01, KEY_MOD_LALT,           KEY_APOSTROPHE,     // ĺ
+    0x3B, 0x01, KEY_MOD_LALT,           KEY_P,              // Ļ
+    0x3C, 0x01, KEY_MOD_LALT,           KEY_B,              // ļ
+    0x3D, 0x01, KEY_MOD_LALT,           KEY_9,              // Ľ
+    0x3E, 0x01, KEY_MOD_LALT,           KEY_0,              // ľ
+    0x41, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Ł
+    0x42, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ł
+    0x43, 0x01, KEY_MOD_LALT,           KEY_1,              // Ń
+    0x44, 0x01, KEY_MOD_LALT,           KEY_F,              // ń
+    0x45, 0x01, KEY_MOD_LALT,           KEY_O,              // Ņ
+    0x46, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ņ
+    0x47, 0x01, KEY_MOD_LALT,           KEY_X,              // Ň
+    0x4C, 0x01, KEY_MOD_LALT,           KEY_Q,              // Ō
+    0x51, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // ő
+    0x55, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ŕ
+    0x56, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // Ŗ
+    0x57, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ŗ
+    0x58, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // Ř
+    0x59, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ř
+    0x5A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // Ś
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_6,              // Š
+    0x61, 0x01, KEY_NONE,               KEY_6,              // š
+    0x6A, 0x01, KEY_MOD_LSHIFT,         KEY_8,              // Ū
+    0x6B, 0x01, KEY_NONE,               KEY_8,              // ū
+    0x6E, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ů
+    0x71, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ű
+    0x72, 0x01, KEY_MOD_LSHIFT,         KEY_7,              // Ų
+    0x73, 0x01, KEY_NONE,               KEY_7,              // ų
+    0x7B, 0x01, KEY_MOD_LALT,           KEY_K,              // Ż
+    0x7C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ż
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          // Ž
+    0x7E, 0x01, KEY_NONE,               KEY_EQUAL,          // ž
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ˇ
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V               // ◊
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LT_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_lt_mac[] = {
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_A,              // á
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xED, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_I,              // í
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_O,              // ö
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_U,              // ú
+    0x0E, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // Ď
+    0x13, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ē
+    0x1B, 0x01, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_U,              // ě
+    0x50, 0x01, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ő
+    0x5B, 0x01, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_E,              // ś
+    0x64, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_E,              // Ť
+    0x6F, 0x01, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_U,              // ů
+    0x7A, 0x01, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_E               // ź
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LT_MAC)
+inline constexpr hid_locale_t locale_lt_mac {
+    ascii_lt_mac, sizeof(ascii_lt_mac) / 3,
+    utf8_lt_mac, sizeof(utf8_lt_mac) / 4,
+    combinations_lt_mac, sizeof(combinations_lt_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LV_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_lv_mac[] = {
+    0x23, KEY_MOD_LSHIFT,         KEY_GRAVE,          // #
+    0x27, KEY_NONE,               KEY_102ND,          // '
+    0x60, KEY_MOD_LALT,           KEY_102ND,          // `
+    0x7E, KEY_MOD_LSHIFT,         KEY_102ND           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LV_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_lv_mac[] = {
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // £
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_Q,              // ©
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_P,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_Y,              // ®
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_M,              // °
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_X,              // ß
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0x00, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Ā
+    0x01, 0x01, KEY_MOD_LALT,           KEY_A,              // ā
+    0x0C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Č
+    0x0D, 0x01, KEY_MOD_LALT,           KEY_C,              // č
+    0x12, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ē
+    0x13, 0x01, KEY_MOD_LALT,           KEY_E,              // ē
+    0x22, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ģ
+    0x23, 0x01, KEY_MOD_LALT,           KEY_G,              // ģ
+    0x2A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // Ī
+    0x2B, 0x01, KEY_MOD_LALT,           KEY_I,              // ī
+    0x36, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // Ķ
+    0x37, 0x01, KEY_MOD_LALT,           KEY_K,              // ķ
+    0x3B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ļ
+    0x3C, 0x01, KEY_MOD_LALT,           KEY_L,              // ļ
+    0x45, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // Ņ
+    0x46, 0x01, KEY_MOD_LALT,           KEY_N,              // ņ
+    0x4C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ō
+    0x4D, 0x01, KEY_MOD_LALT,           KEY_O,              // ō
+    0x56, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // Ŗ
+    0x57, 0x01, KEY_MOD_LALT,           KEY_R,              // ŗ
+    0x60, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Š
+    0x61, 0x01, KEY_MOD_LALT,           KEY_S,              // š
+    0x6A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ū
+    0x6B, 0x01, KEY_MOD_LALT,           KEY_U,              // ū
+    0x7D, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Ž
+    0x7E, 0x01, KEY_MOD_LALT,           KEY_Z,              // ž
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_0,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_9,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0xAC, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x11, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V               // ◊
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LV_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_lv_mac[] = {
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xC1, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC9, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCD, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xD3, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDA, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDC, 0x00, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_A,              // á
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_A,              // ä
+    0xE9, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_E,              // é
+    0xED, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_I,              // í
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_O,              // ô
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_O,              // ö
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_U,              // ú
+    0xFC, 0x00, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_Y,              // ý
+    0x06, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_C,              // ć
+    0x0E, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_D,              // ď
+    0x16, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_E,              // Ė
+    0x17, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_E,              // ė
+    0x1A, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_E,              // ě
+    0x39, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_L,              // Ĺ
+    0x3A, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_L,              // ĺ
+    0x3D, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_L,              // Ľ
+    0x3E, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_L,              // ľ
+    0x43, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_N,              // ń
+    0x47, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_N,              // ň
+    0x50, 0x01, KEY_MOD_LALT,           KEY_W,              KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, KEY_MOD_LALT,           KEY_W,              KEY_NONE,               KEY_O,              // ő
+    0x54, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_R,              // Ŕ
+    0x55, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_R,              // ŕ
+    0x58, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x59, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_R,              // ř
+    0x5A, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_S,              // ś
+    0x64, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x65, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_T,              // ť
+    0x6E, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_W,              // Ů
+    0x6F, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_W,              // ů
+    0x70, 0x01, KEY_MOD_LALT,           KEY_W,              KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, KEY_MOD_LALT,           KEY_W,              KEY_NONE,               KEY_U,              // ű
+    0x79, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_MOD_LSHIFT,         KEY_Z,              // Ź
+    0x7A, 0x01, KEY_MOD_LALT,           KEY_B,              KEY_NONE,               KEY_Z,              // ź
+    0x7B, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_Z,              // Ż
+    0x7C, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_Z,              // ż
+    0xC7, 0x02, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_SPACE           // ˇ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LV_MAC)
+inline constexpr hid_locale_t locale_lv_mac {
+    ascii_lv_mac, sizeof(ascii_lv_mac) / 3,
+    utf8_lv_mac, sizeof(utf8_lv_mac) / 4,
+    combinations_lv_mac, sizeof(combinations_lv_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NL_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_nl_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_9,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB1, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_0,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Á
+    0xC2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // Â
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xC8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // È
+    0xCA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Ê
+    0xCB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ë
+    0xCC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ì
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Î
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xD9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // Ù
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ú
+    0xDB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Û
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x78, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // Ÿ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˆ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ˘
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_H,              // ˙
+    0xDA, 0x02, KEY_MOD_LALT,           KEY_K,              // ˚
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ˜
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_2,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NL_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_nl_mac[] = {
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xC0, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xE0, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_I,              // í
+    0xEF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_U,              // û
+    0xFF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NL_MAC)
+inline constexpr hid_locale_t locale_nl_mac {
+    ascii_in_mac, sizeof(ascii_in_mac) / 3,
+    utf8_nl_mac, sizeof(utf8_nl_mac) / 4,
+    combinations_nl_mac, sizeof(combinations_nl_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NO_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_no_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_GRAVE,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_MINUS,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_NONE,               KEY_BACKSLASH,      // @
+    0x5B, KEY_MOD_LALT,           KEY_8,              // [
+    0x5C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // bslash
+    0x5D, KEY_MOD_LALT,           KEY_9,              // ]
+    0x5E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_LALT,           KEY_EQUAL,          // `
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // {
+    0x7C, KEY_MOD_LALT,           KEY_7,              // |
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // }
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NO_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_no_mac[] = {
+    0xA1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ¡
+    0xA2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ¥
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_1,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_K,              // ª
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ¬
+    0xAE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // °
+    0xB1, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_Y,              // µ
+    0xB6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ·
+    0xB8, 0x00, KEY_MOD_LALT,           KEY_G,              // ¸
+    0xBA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¿
+    0xC4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Ä
+    0xC5, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Å
+    0xC6, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // É
+    0xD6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ö
+    0xD8, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ø
+    0xDC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ü
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // ä
+    0xE5, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // å
+    0xE6, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xE9, 0x00, KEY_MOD_LALT,           KEY_E,              // é
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // ö
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_Z,              // ÷
+    0xF8, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ø
+    0xFC, 0x00, KEY_MOD_LALT,           KEY_U,              // ü
+    0x31, 0x01, KEY_MOD_LALT,           KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_O,              // œ
+    0x78, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // Ÿ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ˆ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // ˘
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_LEFTBRACE,      // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ˚
+    0xDB, 0x02, KEY_MOD_LALT,           KEY_H,              // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_W,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_N,              // ‘
+    0x19, 0x20, KEY_MOD_LALT,           KEY_M,              // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // ‚
+    0x1C, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_Q,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_V,              // ‹
+    0x3A, 0x20, KEY_MOD_LALT,           KEY_B,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_4,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_J,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_0,              // ≈
+    0x60, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // ◊
+    0xFF, 0xF8, KEY_MOD_LALT,           KEY_A,              // 
+    0x01, 0xFB, KEY_MOD_LALT,           KEY_L,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NO_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_no_mac[] = {
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // â
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // û
+    0xFF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NO_MAC)
+inline constexpr hid_locale_t locale_no_mac {
+    ascii_no_mac, sizeof(ascii_no_mac) / 3,
+    utf8_no_mac, sizeof(utf8_no_mac) / 4,
+    combinations_no_mac, sizeof(combinations_no_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PL_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_pl_mac[] = {
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // £
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Á
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ú
+    0xDD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // Ý
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_4,              // ß
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_O,              // ó
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xFD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ý
+    0x04, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_LALT,           KEY_A,              // ą
+    0x06, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ć
+    0x07, 0x01, KEY_MOD_LALT,           KEY_C,              // ć
+    0x18, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_LALT,           KEY_E,              // ę
+    0x23, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // ģ
+    0x2A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // Ī
+    0x2B, 0x01, KEY_MOD_LALT,           KEY_Y,              // ī
+    0x2F, 0x01, KEY_MOD_LALT,           KEY_5,              // į
+    0x36, 0x01, KEY_MOD_LALT,           KEY_M,              // Ķ
+    0x37, 0x01, KEY_MOD_LALT,           KEY_H,              // ķ
+    0x3A, 0x01, KEY_MOD_LALT,           KEY_APOSTROPHE,     // ĺ
+    0x3B, 0x01, KEY_MOD_LALT,           KEY_P,              // Ļ
+    0x3C, 0x01, KEY_MOD_LALT,           KEY_B,              // ļ
+    0x3D, 0x01, KEY_MOD_LALT,           KEY_9,              // Ľ
+    0x3E, 0x01, KEY_MOD_LALT,           KEY_0,              // ľ
+    0x41, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_LALT,           KEY_L,              // ł
+    0x43, 0x01, KEY_MOD_LALT,           KEY_1,              // Ń
+    0x44, 0x01, KEY_MOD_LALT,           KEY_F,              // ń
+    0x46, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ņ
+    0x4C, 0x01, KEY_MOD_LALT,           KEY_Q,              // Ō
+    0x51, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // ő
+    0x54, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // Ŕ
+    0x55, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ŕ
+    0x56, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // Ŗ
+    0x57, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ŗ
+    0x58, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // Ř
+    0x59, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ř
+    0x5A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Ś
+    0x5B, 0x01, KEY_MOD_LALT,           KEY_S,              // ś
+    0x60, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // Š
+    0x64, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ť
+    0x65, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ť
+    0x6A, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ū
+    0x6B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ū
+    0x71, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ű
+    0x73, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ų
+    0x79, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // Ź
+    0x7A, 0x01, KEY_MOD_LALT,           KEY_X,              // ź
+    0x7B, 0x01, KEY_MOD_LALT,           KEY_K,              // Ż
+    0x7C, 0x01, KEY_MOD_LALT,           KEY_Z,              // ż
+    0x7D, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Ž
+    0x7E, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ž
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‚
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_3,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V               // ◊
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PL_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_pl_mac[] = {
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_O,              // ô
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_O,              // ö
+    0x0C, 0x01, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_A,              // Č
+    0x0E, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // Ď
+    0x0F, 0x01, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_I,              // ď
+    0x13, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ē
+    0x17, 0x01, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_O,              // ė
+    0x1A, 0x01, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_U,              // Ě
+    0x1B, 0x01, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_U,              // ě
+    0x48, 0x01, KEY_MOD_LALT,           KEY_102ND,          KEY_MOD_LSHIFT,         KEY_A,              // ň
+    0x4D, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_Y,              // ō
+    0x6E, 0x01, KEY_MOD_LALT,           KEY_102ND,          KEY_MOD_LSHIFT,         KEY_O,              // Ů
+    0x6F, 0x01, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_U,              // ů
+    0x70, 0x01, KEY_MOD_LALT,           KEY_102ND,          KEY_MOD_LSHIFT,         KEY_U               // Ű
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PL_MAC)
+inline constexpr hid_locale_t locale_pl_mac {
+    ascii_in_mac, sizeof(ascii_in_mac) / 3,
+    utf8_pl_mac, sizeof(utf8_pl_mac) / 4,
+    combinations_pl_mac, sizeof(combinations_pl_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_pt_br_mac[] = {
+    0x22, KEY_NONE,               KEY_SPACE,          // "
+    0x27, KEY_NONE,               KEY_SPACE,          // '
+    0x5E, KEY_NONE,               KEY_NONE,           // ^
+    0x60, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // `
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_pt_br_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ¨
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_9,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB1, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ±
+    0xB4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ´
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xB8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ¸
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_0,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Á
+    0xC2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // Â
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Î
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ú
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ˆ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ˘
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_H,              // ˙
+    0xDA, 0x02, KEY_MOD_LALT,           KEY_K,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ⁄
+    0xAC, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_pt_br_mac[] = {
+    0x22, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // "
+    0x27, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // '
+    0xC0, 0x00, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC3, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xD1, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD5, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_NONE,               KEY_102ND,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE0, 0x00, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_NONE,               KEY_102ND,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ü
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_Y,              // ÿ
+    0x78, 0x01, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Y               // Ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR_MAC)
+inline constexpr hid_locale_t locale_pt_br_mac {
+    ascii_pt_br_mac, sizeof(ascii_pt_br_mac) / 3,
+    utf8_pt_br_mac, sizeof(utf8_pt_br_mac) / 4,
+    combinations_pt_br_mac, sizeof(combinations_pt_br_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_pt_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_EQUAL,          // *
+    0x2B, KEY_NONE,               KEY_EQUAL,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x5B, KEY_MOD_LALT,           KEY_8,              // [
+    0x5D, KEY_MOD_LALT,           KEY_9,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // {
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_pt_mac[] = {
+    0xA1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ¡
+    0xA2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_4,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_C,              // ©
+    0xAA, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_X,              // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_N,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, KEY_MOD_LALT,           KEY_J,              // ¯
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      // °
+    0xB1, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_6,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ·
+    0xB8, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // ¸
+    0xBA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¿
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Æ
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ç
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_E,              // æ
+    0xE7, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ç
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_7,              // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x31, 0x01, KEY_MOD_LALT,           KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC7, 0x02, KEY_MOD_LALT,           KEY_H,              // ˇ
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_G,              // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // ˛
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // –
+    0x14, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_L,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // ”
+    0x1E, 0x20, KEY_MOD_LALT,           KEY_K,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_U,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ‡
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, KEY_MOD_LALT,           KEY_5,              // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_BACKSLASH,      // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_3,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_T,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ◊
+    0xFF, 0xF8, KEY_MOD_LALT,           KEY_1,              // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_pt_mac[] = {
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ~
+    0xB4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xD1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // ã
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ê
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // î
+    0xF1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // õ
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_MAC)
+inline constexpr hid_locale_t locale_pt_mac {
+    ascii_pt_mac, sizeof(ascii_pt_mac) / 3,
+    utf8_pt_mac, sizeof(utf8_pt_mac) / 4,
+    combinations_pt_mac, sizeof(combinations_pt_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RO_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ro_mac[] = {
+    0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // "
+    0x27, KEY_MOD_LALT,           KEY_APOSTROPHE,     // '
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_MOD_LALT,           KEY_COMMA,          // <
+    0x3E, KEY_MOD_LALT,           KEY_DOT,            // >
+    0x5B, KEY_MOD_LALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_NONE,               KEY_102ND,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ]
+    0x60, KEY_MOD_LALT,           KEY_GRAVE,          // `
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_102ND,          // |
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // }
+    0x7E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RO_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ro_mac[] = {
+    0xA0, 0x00, KEY_MOD_LALT,           KEY_SPACE,
+    0xA5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ¥
+    0xA7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // §
+    0xA8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ¨
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_C,              // ©
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // «
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Â
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Î
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE2, 0x00, KEY_NONE,               KEY_BACKSLASH,      // â
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xEE, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // î
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0x02, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ă
+    0x03, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // ă
+    0x10, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Đ
+    0x11, 0x01, KEY_MOD_LALT,           KEY_D,              // đ
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ı
+    0x41, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_LALT,           KEY_L,              // ł
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xB5, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Ƶ
+    0xB6, 0x01, KEY_MOD_LALT,           KEY_Z,              // ƶ
+    0x18, 0x02, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ș
+    0x19, 0x02, KEY_NONE,               KEY_SEMICOLON,      // ș
+    0x1A, 0x02, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ț
+    0x1B, 0x02, KEY_NONE,               KEY_APOSTROPHE,     // ț
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ˆ
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_H,              // ˙
+    0xDA, 0x02, KEY_MOD_LALT,           KEY_K,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ˝
+    0x98, 0x03, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Θ
+    0xB8, 0x03, KEY_MOD_LALT,           KEY_T,              // θ
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // “
+    0x1D, 0x20, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ”
+    0x1E, 0x20, KEY_NONE,               KEY_GRAVE,          // „
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ‡
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ⁄
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x64, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K               // 
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RO_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ro_mac[] = {
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_SPACE,          // ´
+    0xB8, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ¸
+    0xC0, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_1,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC7, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Ç
+    0xC8, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xD1, 0x00, KEY_MOD_LALT,           KEY_1,              KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_1,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_A,              // á
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_1,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_A,              // ä
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_C,              // ç
+    0xE8, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_3,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_I,              // í
+    0xEF, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, KEY_MOD_LALT,           KEY_1,              KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_3,              KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_1,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LALT,           KEY_7,              KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_3,              KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_Y,              // ÿ
+    0x04, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_A,              // ą
+    0x06, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_C,              // ć
+    0x08, 0x01, KEY_MOD_LALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_C,              // Ĉ
+    0x09, 0x01, KEY_MOD_LALT,           KEY_3,              KEY_NONE,               KEY_C,              // ĉ
+    0x0A, 0x01, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_C,              // Ċ
+    0x0B, 0x01, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_C,              // ċ
+    0x0C, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0D, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_C,              // č
+    0x0E, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_D,              // ď
+    0x14, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_E,              // Ĕ
+    0x15, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_E,              // ĕ
+    0x16, 0x01, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_E,              // Ė
+    0x17, 0x01, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_E,              // ė
+    0x18, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_E,              // ę
+    0x1A, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_E,              // ě
+    0x28, 0x01, KEY_MOD_LALT,           KEY_1,              KEY_MOD_LSHIFT,         KEY_I,              // Ĩ
+    0x29, 0x01, KEY_MOD_LALT,           KEY_1,              KEY_NONE,               KEY_I,              // ĩ
+    0x2C, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_I,              // Ĭ
+    0x2D, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_I,              // ĭ
+    0x2E, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_I,              // Į
+    0x2F, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_I,              // į
+    0x30, 0x01, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_I,              // İ
+    0x39, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_L,              // Ĺ
+    0x3A, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_L,              // ĺ
+    0x3B, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ļ
+    0x3C, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_L,              // ļ
+    0x3D, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_L,              // Ľ
+    0x3E, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_L,              // ľ
+    0x43, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_N,              // ń
+    0x45, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ņ
+    0x46, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_N,              // ņ
+    0x47, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_N,              // ň
+    0x4E, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_O,              // Ŏ
+    0x4F, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_O,              // ŏ
+    0x50, 0x01, KEY_MOD_LALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, KEY_MOD_LALT,           KEY_0,              KEY_NONE,               KEY_O,              // ő
+    0x54, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_R,              // Ŕ
+    0x55, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_R,              // ŕ
+    0x56, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ŗ
+    0x57, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_R,              // ŗ
+    0x58, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x59, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_R,              // ř
+    0x5A, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_S,              // ś
+    0x5C, 0x01, KEY_MOD_LALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_S,              // Ŝ
+    0x5D, 0x01, KEY_MOD_LALT,           KEY_3,              KEY_NONE,               KEY_S,              // ŝ
+    0x5E, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Ş
+    0x5F, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_S,              // ş
+    0x60, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_S,              // Š
+    0x61, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_S,              // š
+    0x62, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_T,              // Ţ
+    0x63, 0x01, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_T,              // ţ
+    0x64, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x65, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_T,              // ť
+    0x68, 0x01, KEY_MOD_LALT,           KEY_1,              KEY_MOD_LSHIFT,         KEY_U,              // Ũ
+    0x69, 0x01, KEY_MOD_LALT,           KEY_1,              KEY_NONE,               KEY_U,              // ũ
+    0x6C, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_U,              // Ŭ
+    0x6D, 0x01, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_U,              // ŭ
+    0x6E, 0x01, KEY_MOD_LALT,           KEY_5,              KEY_MOD_LSHIFT,         KEY_U,              // Ů
+    0x6F, 0x01, KEY_MOD_LALT,           KEY_5,              KEY_NONE,               KEY_U,              // ů
+    0x70, 0x01, KEY_MOD_LALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, KEY_MOD_LALT,           KEY_0,              KEY_NONE,               KEY_U,              // ű
+    0x72, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_U,              // Ų
+    0x73, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_U,              // ų
+    0x76, 0x01, KEY_MOD_LALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_Y,              // Ŷ
+    0x77, 0x01, KEY_MOD_LALT,           KEY_3,              KEY_NONE,               KEY_Y,              // ŷ
+    0x78, 0x01, KEY_MOD_LALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_Y,              // Ÿ
+    0x79, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_Z,              // Ź
+    0x7A, 0x01, KEY_MOD_LALT,           KEY_9,              KEY_NONE,               KEY_Z,              // ź
+    0x7B, 0x01, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_Z,              // Ż
+    0x7C, 0x01, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_Z,              // ż
+    0x7D, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_Z,              // Ž
+    0x7E, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_Z,              // ž
+    0xCD, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_A,              // Ǎ
+    0xCE, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_A,              // ǎ
+    0xCF, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_I,              // Ǐ
+    0xD0, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_I,              // ǐ
+    0xD1, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_O,              // Ǒ
+    0xD2, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_O,              // ǒ
+    0xD3, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_U,              // Ǔ
+    0xD4, 0x01, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_U,              // ǔ
+    0xEA, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_O,              // Ǫ
+    0xEB, 0x01, KEY_MOD_LALT,           KEY_6,              KEY_NONE,               KEY_O,              // ǫ
+    0xF8, 0x01, KEY_MOD_LALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_N,              // Ǹ
+    0xF9, 0x01, KEY_MOD_LALT,           KEY_7,              KEY_NONE,               KEY_N,              // ǹ
+    0x26, 0x02, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_A,              // Ȧ
+    0x27, 0x02, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_A,              // ȧ
+    0x28, 0x02, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ȩ
+    0x29, 0x02, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_E,              // ȩ
+    0x2E, 0x02, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_O,              // Ȯ
+    0x2F, 0x02, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_O,              // ȯ
+    0xC7, 0x02, KEY_MOD_LALT,           KEY_2,              KEY_NONE,               KEY_SPACE,          // ˇ
+    0xD8, 0x02, KEY_MOD_LALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ˘
+    0x02, 0x03, KEY_MOD_LALT,           KEY_3,              KEY_NONE,               KEY_N,              // ̂
+    0x08, 0x03, KEY_MOD_LALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_T,              // ̈
+    0x0A, 0x03, KEY_MOD_LALT,           KEY_5,              KEY_NONE,               KEY_E,              // ̊
+    0x27, 0x03, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_Z,              // ̧
+    0x0A, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_D,              // Ḋ
+    0x0B, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_D,              // ḋ
+    0x10, 0x1E, KEY_MOD_LALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_D,              // Ḑ
+    0x11, 0x1E, KEY_MOD_LALT,           KEY_EQUAL,          KEY_NONE,               KEY_D,              // ḑ
+    0x44, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_N,              // Ṅ
+    0x45, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_N,              // ṅ
+    0x58, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_R,              // Ṙ
+    0x59, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_R,              // ṙ
+    0x60, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_S,              // Ṡ
+    0x61, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_S,              // ṡ
+    0x6A, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_T,              // Ṫ
+    0x6B, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_T,              // ṫ
+    0x8E, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_Y,              // Ẏ
+    0x8F, 0x1E, KEY_MOD_LALT,           KEY_8,              KEY_NONE,               KEY_Y,              // ẏ
+    0x90, 0x1E, KEY_MOD_LALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_Z,              // Ẑ
+    0x91, 0x1E, KEY_MOD_LALT,           KEY_3,              KEY_NONE,               KEY_Z,              // ẑ
+    0x97, 0x1E, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_T,              // ẗ
+    0x99, 0x1E, KEY_MOD_LALT,           KEY_5,              KEY_NONE,               KEY_Y,              // ẙ
+    0xBC, 0x1E, KEY_MOD_LALT,           KEY_1,              KEY_MOD_LSHIFT,         KEY_E,              // Ẽ
+    0xBD, 0x1E, KEY_MOD_LALT,           KEY_1,              KEY_NONE,               KEY_E,              // ẽ
+    0xF2, 0x1E, KEY_MOD_LALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_Y,              // Ỳ
+    0xF3, 0x1E, KEY_MOD_LALT,           KEY_7,              KEY_NONE,               KEY_Y,              // ỳ
+    0xF8, 0x1E, KEY_MOD_LALT,           KEY_1,              KEY_MOD_LSHIFT,         KEY_Y,              // Ỹ
+    0xF9, 0x1E, KEY_MOD_LALT,           KEY_1,              KEY_NONE,               KEY_Y               // ỹ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RO_MAC)
+inline constexpr hid_locale_t locale_ro_mac {
+    ascii_ro_mac, sizeof(ascii_ro_mac) / 3,
+    utf8_ro_mac, sizeof(utf8_ro_mac) / 4,
+    combinations_ro_mac, sizeof(combinations_ro_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RU_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ru_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_LALT,           KEY_3,              // #
+    0x24, KEY_MOD_LALT,           KEY_4,              // $
+    0x25, KEY_MOD_LSHIFT,         KEY_4,              // %
+    0x26, KEY_MOD_LALT,           KEY_7,              // &
+    0x27, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // '
+    0x2A, KEY_MOD_LALT,           KEY_8,              // *
+    0x2C, KEY_MOD_LSHIFT,         KEY_6,              // ,
+    0x2E, KEY_MOD_LSHIFT,         KEY_7,              // .
+    0x3A, KEY_MOD_LSHIFT,         KEY_5,              // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_8,              // ;
+    0x3C, KEY_MOD_LSHIFT,         KEY_GRAVE,          // <
+    0x3E, KEY_NONE,               KEY_GRAVE,          // >
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x41, KEY_NONE,               KEY_NONE,           // A
+    0x42, KEY_NONE,               KEY_NONE,           // B
+    0x43, KEY_NONE,               KEY_NONE,           // C
+    0x44, KEY_NONE,               KEY_NONE,           // D
+    0x45, KEY_NONE,               KEY_NONE,           // E
+    0x46, KEY_NONE,               KEY_NONE,           // F
+    0x47, KEY_NONE,               KEY_NONE,           // G
+    0x48, KEY_NONE,               KEY_NONE,           // H
+    0x49, KEY_NONE,               KEY_NONE,           // I
+    0x4A, KEY_NONE,               KEY_NONE,           // J
+    0x4B, KEY_NONE,               KEY_NONE,           // K
+    0x4C, KEY_NONE,               KEY_NONE,           // L
+    0x4D, KEY_NONE,               KEY_NONE,           // M
+    0x4E, KEY_NONE,               KEY_NONE,           // N
+    0x4F, KEY_NONE,               KEY_NONE,           // O
+    0x50, KEY_NONE,               KEY_NONE,           // P
+    0x51, KEY_NONE,               KEY_NONE,           // Q
+    0x52, KEY_NONE,               KEY_NONE,           // R
+    0x53, KEY_NONE,               KEY_NONE,           // S
+    0x54, KEY_NONE,               KEY_NONE,           // T
+    0x55, KEY_NONE,               KEY_NONE,           // U
+    0x56, KEY_NONE,               KEY_NONE,           // V
+    0x57, KEY_NONE,               KEY_NONE,           // W
+    0x58, KEY_NONE,               KEY_NONE,           // X
+    0x59, KEY_NONE,               KEY_NONE,           // Y
+    0x5A, KEY_NONE,               KEY_NONE,           // Z
+    0x5B, KEY_MOD_LSHIFT,         KEY_102ND,          // [
+    0x5C, KEY_NONE,               KEY_NONE,           // bslash
+    0x5D, KEY_NONE,               KEY_102ND,          // ]
+    0x5E, KEY_MOD_LALT,           KEY_6,              // ^
+    0x60, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // `
+    0x61, KEY_NONE,               KEY_NONE,           // a
+    0x62, KEY_NONE,               KEY_NONE,           // b
+    0x63, KEY_NONE,               KEY_NONE,           // c
+    0x64, KEY_NONE,               KEY_NONE,           // d
+    0x65, KEY_NONE,               KEY_NONE,           // e
+    0x66, KEY_NONE,               KEY_NONE,           // f
+    0x67, KEY_NONE,               KEY_NONE,           // g
+    0x68, KEY_NONE,               KEY_NONE,           // h
+    0x69, KEY_NONE,               KEY_NONE,           // i
+    0x6A, KEY_NONE,               KEY_NONE,           // j
+    0x6B, KEY_NONE,               KEY_NONE,           // k
+    0x6C, KEY_NONE,               KEY_NONE,           // l
+    0x6D, KEY_NONE,               KEY_NONE,           // m
+    0x6E, KEY_NONE,               KEY_NONE,           // n
+    0x6F, KEY_NONE,               KEY_NONE,           // o
+    0x70, KEY_NONE,               KEY_NONE,           // p
+    0x71, KEY_NONE,               KEY_NONE,           // q
+    0x72, KEY_NONE,               KEY_NONE,           // r
+    0x73, KEY_NONE,               KEY_NONE,           // s
+    0x74, KEY_NONE,               KEY_NONE,           // t
+    0x75, KEY_NONE,               KEY_NONE,           // u
+    0x76, KEY_NONE,               KEY_NONE,           // v
+    0x77, KEY_NONE,               KEY_NONE,           // w
+    0x78, KEY_NONE,               KEY_NONE,           // x
+    0x79, KEY_NONE,               KEY_NONE,           // y
+    0x7A, KEY_NONE,               KEY_NONE,           // z
+    0x7B, KEY_MOD_LALT,           KEY_9,              // {
+    0x7C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // |
+    0x7D, KEY_MOD_LALT,           KEY_0,              // }
+    0x7E, KEY_MOD_LALT,           KEY_M               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RU_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ru_mac[] = {
+    0xA3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // £
+    0xA7, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_J,              // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_V,              // µ
+    0xB6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ¶
+    0xBB, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          // »
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_F,              // ÷
+    0x92, 0x01, KEY_MOD_LALT,           KEY_A,              // ƒ
+    0x01, 0x04, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ё
+    0x02, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Ђ
+    0x03, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ѓ
+    0x05, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // Ѕ
+    0x08, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Ј
+    0x09, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // Љ
+    0x0A, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Њ
+    0x0B, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Ћ
+    0x0C, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ќ
+    0x0E, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ў
+    0x0F, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Џ
+    0x10, 0x04, KEY_MOD_LSHIFT,         KEY_F,              // А
+    0x11, 0x04, KEY_MOD_LSHIFT,         KEY_COMMA,          // Б
+    0x12, 0x04, KEY_MOD_LSHIFT,         KEY_D,              // В
+    0x13, 0x04, KEY_MOD_LSHIFT,         KEY_U,              // Г
+    0x14, 0x04, KEY_MOD_LSHIFT,         KEY_L,              // Д
+    0x15, 0x04, KEY_MOD_LSHIFT,         KEY_T,              // Е
+    0x16, 0x04, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ж
+    0x17, 0x04, KEY_MOD_LSHIFT,         KEY_P,              // З
+    0x18, 0x04, KEY_MOD_LSHIFT,         KEY_B,              // И
+    0x19, 0x04, KEY_MOD_LSHIFT,         KEY_Q,              // Й
+    0x1A, 0x04, KEY_MOD_LSHIFT,         KEY_R,              // К
+    0x1B, 0x04, KEY_MOD_LSHIFT,         KEY_K,              // Л
+    0x1C, 0x04, KEY_MOD_LSHIFT,         KEY_V,              // М
+    0x1D, 0x04, KEY_MOD_LSHIFT,         KEY_Y,              // Н
+    0x1E, 0x04, KEY_MOD_LSHIFT,         KEY_J,              // О
+    0x1F, 0x04, KEY_MOD_LSHIFT,         KEY_G,              // П
+    0x20, 0x04, KEY_MOD_LSHIFT,         KEY_H,              // Р
+    0x21, 0x04, KEY_MOD_LSHIFT,         KEY_C,              // С
+    0x22, 0x04, KEY_MOD_LSHIFT,         KEY_N,              // Т
+    0x23, 0x04, KEY_MOD_LSHIFT,         KEY_E,              // У
+    0x24, 0x04, KEY_MOD_LSHIFT,         KEY_A,              // Ф
+    0x25, 0x04, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Х
+    0x26, 0x04, KEY_MOD_LSHIFT,         KEY_W,              // Ц
+    0x27, 0x04, KEY_MOD_LSHIFT,         KEY_X,              // Ч
+    0x28, 0x04, KEY_MOD_LSHIFT,         KEY_I,              // Ш
+    0x29, 0x04, KEY_MOD_LSHIFT,         KEY_O,              // Щ
+    0x2A, 0x04, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ъ
+    0x2B, 0x04, KEY_MOD_LSHIFT,         KEY_S,              // Ы
+    0x2C, 0x04, KEY_MOD_LSHIFT,         KEY_M,              // Ь
+    0x2D, 0x04, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Э
+    0x2E, 0x04, KEY_MOD_LSHIFT,         KEY_DOT,            // Ю
+    0x2F, 0x04, KEY_MOD_LSHIFT,         KEY_Z,              // Я
+    0x30, 0x04, KEY_NONE,               KEY_F,              // а
+    0x31, 0x04, KEY_NONE,               KEY_COMMA,          // б
+    0x32, 0x04, KEY_NONE,               KEY_D,              // в
+    0x33, 0x04, KEY_NONE,               KEY_U,              // г
+    0x34, 0x04, KEY_NONE,               KEY_L,              // д
+    0x35, 0x04, KEY_NONE,               KEY_T,              // е
+    0x36, 0x04, KEY_NONE,               KEY_SEMICOLON,      // ж
+    0x37, 0x04, KEY_NONE,               KEY_P,              // з
+    0x38, 0x04, KEY_NONE,               KEY_B,              // и
+    0x39, 0x04, KEY_NONE,               KEY_Q,              // й
+    0x3A, 0x04, KEY_NONE,               KEY_R,              // к
+    0x3B, 0x04, KEY_NONE,               KEY_K,              // л
+    0x3C, 0x04, KEY_NONE,               KEY_V,              // м
+    0x3D, 0x04, KEY_NONE,               KEY_Y,              // н
+    0x3E, 0x04, KEY_NONE,               KEY_J,              // о
+    0x3F, 0x04, KEY_NONE,               KEY_G,              // п
+    0x40, 0x04, KEY_NONE,               KEY_H,              // р
+    0x41, 0x04, KEY_NONE,               KEY_C,              // с
+    0x42, 0x04, KEY_NONE,               KEY_N,              // т
+    0x43, 0x04, KEY_NONE,               KEY_E,              // у
+    0x44, 0x04, KEY_NONE,               KEY_A,              // ф
+    0x45, 0x04, KEY_NONE,               KEY_LEFTBRACE,      // х
+    0x46, 0x04, KEY_NONE,               KEY_W,              // ц
+    0x47, 0x04, KEY_NONE,               KEY_X,              // ч
+    0x48, 0x04, KEY_NONE,               KEY_I,              // ш
+    0x49, 0x04, KEY_NONE,               KEY_O,              // щ
+    0x4A, 0x04, KEY_NONE,               KEY_RIGHTBRACE,     // ъ
+    0x4B, 0x04, KEY_NONE,               KEY_S,              // ы
+    0x4C, 0x04, KEY_NONE,               KEY_M,              // ь
+    0x4D, 0x04, KEY_NONE,               KEY_APOSTROPHE,     // э
+    0x4E, 0x04, KEY_NONE,               KEY_DOT,            // ю
+    0x4F, 0x04, KEY_NONE,               KEY_Z,              // я
+    0x51, 0x04, KEY_NONE,               KEY_BACKSLASH,      // ё
+    0x52, 0x04, KEY_MOD_LALT,           KEY_Z,              // ђ
+    0x53, 0x04, KEY_MOD_LALT,           KEY_U,              // ѓ
+    0x55, 0x04, KEY_MOD_LALT,           KEY_I,              // ѕ
+    0x58, 0x04, KEY_MOD_LALT,           KEY_Q,              // ј
+    0x59, 0x04, KEY_MOD_LALT,           KEY_K,              // љ
+    0x5A, 0x04, KEY_MOD_LALT,           KEY_Y,              // њ
+    0x5B, 0x04, KEY_MOD_LALT,           KEY_D,              // ћ
+    0x5C, 0x04, KEY_MOD_LALT,           KEY_E,              // ќ
+    0x5E, 0x04, KEY_MOD_LALT,           KEY_O,              // ў
+    0x5F, 0x04, KEY_MOD_LALT,           KEY_W,              // џ
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_P,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ’
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0xAC, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // €
+    0xBD, 0x20, KEY_MOD_LALT,           KEY_H,              // ₽
+    0x16, 0x21, KEY_MOD_LSHIFT,         KEY_3,              // №
+    0x22, 0x21, KEY_MOD_LALT,           KEY_N,              // ™
+    0x06, 0x22, KEY_MOD_LALT,           KEY_L,              // ∆
+    0x1A, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // √
+    0x1E, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ∞
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_C,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT             // ≥
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RU_MAC) || defined(LOCALE_UA_MAC) || defined(LOCALE_BG) || defined(LOCALE_GB) || defined(LOCALE_IT) || defined(LOCALE_LT) || defined(LOCALE_RU) || defined(LOCALE_UA) || defined(LOCALE_US)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ru_mac[] = {
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RU_MAC)
+inline constexpr hid_locale_t locale_ru_mac {
+    ascii_ru_mac, sizeof(ascii_ru_mac) / 3,
+    utf8_ru_mac, sizeof(utf8_ru_mac) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SE_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_se_mac[] = {
+    0xA1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ¡
+    0xA2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_1,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_K,              // ª
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ¯
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xB1, 0x00, KEY_MOD_LALT,           KEY_MINUS,          // ±
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          // ´
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_Y,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ·
+    0xB8, 0x00, KEY_MOD_LALT,           KEY_G,              // ¸
+    0xBA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // ¿
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ä
+    0xC5, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // É
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ö
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ø
+    0xDC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // Ü
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xE5, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xE9, 0x00, KEY_MOD_LALT,           KEY_E,              // é
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_Z,              // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      // ø
+    0xFC, 0x00, KEY_MOD_LALT,           KEY_U,              // ü
+    0x31, 0x01, KEY_MOD_LALT,           KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_O,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ˆ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // ˘
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_LEFTBRACE,      // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ˚
+    0xDB, 0x02, KEY_MOD_LALT,           KEY_H,              // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_W,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_N,              // ‘
+    0x19, 0x20, KEY_MOD_LALT,           KEY_M,              // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_COMMA,          // ‚
+    0x1C, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_Q,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_DOT,            // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_V,              // ‹
+    0x3A, 0x20, KEY_MOD_LALT,           KEY_B,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ⁄
+    0xAC, 0x20, KEY_MOD_LSHIFT,         KEY_4,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_BACKSLASH,      // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_J,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_0,              // ≈
+    0x60, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_102ND,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // ◊
+    0xFF, 0xF8, KEY_MOD_LALT,           KEY_A,              // 
+    0x01, 0xFB, KEY_MOD_LALT,           KEY_L,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SE_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_se_mac[] = {
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // â
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // û
+    0xFD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_Y,              // ÿ
+    0x78, 0x01, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_Y               // Ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SE_MAC)
+inline constexpr hid_locale_t locale_se_mac {
+    ascii_fi_mac, sizeof(ascii_fi_mac) / 3,
+    utf8_se_mac, sizeof(utf8_se_mac) / 4,
+    combinations_se_mac, sizeof(combinations_se_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SI_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_si_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_7,              // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_EQUAL,          // *
+    0x2B, KEY_NONE,               KEY_EQUAL,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_NONE,               KEY_MINUS,          // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // @
+    0x5B, KEY_MOD_LALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_MOD_LALT,           KEY_BACKSLASH,      // bslash
+    0x5D, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_MOD_LALT,           KEY_APOSTROPHE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_LALT,           KEY_RO,             // `
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // {
+    0x7C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // |
+    0x7D, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // }
+    0x7E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SI_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_si_mac[] = {
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA7, 0x00, KEY_MOD_LALT,           KEY_6,              // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_9,              // ª
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_0,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ¿
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xC8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // È
+    0xC9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // É
+    0xCC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // Ì
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Î
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // Ñ
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x06, 0x01, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ć
+    0x07, 0x01, KEY_NONE,               KEY_APOSTROPHE,     // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Č
+    0x0D, 0x01, KEY_NONE,               KEY_SEMICOLON,      // č
+    0x10, 0x01, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Đ
+    0x11, 0x01, KEY_NONE,               KEY_RIGHTBRACE,     // đ
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Š
+    0x61, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // š
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ž
+    0x7E, 0x01, KEY_NONE,               KEY_BACKSLASH,      // ž
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˆ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ˇ
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // –
+    0x14, 0x20, KEY_MOD_LALT,           KEY_Y,              // —
+    0x18, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, KEY_NONE,               KEY_GRAVE,          // “
+    0x1D, 0x20, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ‰
+    0x39, 0x20, KEY_MOD_LALT,           KEY_GRAVE,          // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ⁄
+    0xAC, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K               // 
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SI_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_si_mac[] = {
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xCA, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE0, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // ë
+    0xF2, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LALT,           KEY_102ND,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SI_MAC)
+inline constexpr hid_locale_t locale_si_mac {
+    ascii_si_mac, sizeof(ascii_si_mac) / 3,
+    utf8_si_mac, sizeof(utf8_si_mac) / 4,
+    combinations_si_mac, sizeof(combinations_si_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SK_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_sk_mac[] = {
+    0x21, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // !
+    0x22, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // "
+    0x23, KEY_MOD_LALT,           KEY_3,              // #
+    0x24, KEY_MOD_LALT,           KEY_4,              // $
+    0x25, KEY_MOD_LSHIFT,         KEY_MINUS,          // %
+    0x26, KEY_MOD_LALT,           KEY_7,              // &
+    0x27, KEY_MOD_LALT,           KEY_APOSTROPHE,     // '
+    0x28, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // (
+    0x29, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // )
+    0x2A, KEY_MOD_LALT,           KEY_8,              // *
+    0x2B, KEY_NONE,               KEY_1,              // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // /
+    0x30, KEY_MOD_LSHIFT,         KEY_0,              // 0
+    0x31, KEY_MOD_LSHIFT,         KEY_1,              // 1
+    0x32, KEY_MOD_LSHIFT,         KEY_2,              // 2
+    0x33, KEY_MOD_LSHIFT,         KEY_3,              // 3
+    0x34, KEY_MOD_LSHIFT,         KEY_4,              // 4
+    0x35, KEY_MOD_LSHIFT,         KEY_5,              // 5
+    0x36, KEY_MOD_LSHIFT,         KEY_6,              // 6
+    0x37, KEY_MOD_LSHIFT,         KEY_7,              // 7
+    0x38, KEY_MOD_LSHIFT,         KEY_8,              // 8
+    0x39, KEY_MOD_LSHIFT,         KEY_9,              // 9
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_NONE,           // ;
+    0x3C, KEY_NONE,               KEY_GRAVE,          // <
+    0x3D, KEY_NONE,               KEY_MINUS,          // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_GRAVE,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_COMMA,          // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_NONE,               KEY_NONE,           // [
+    0x5C, KEY_NONE,               KEY_102ND,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_MOD_LALT,           KEY_6,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_LALT,           KEY_1,              // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_LALT,           KEY_9,              // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_102ND,          // |
+    0x7D, KEY_MOD_LALT,           KEY_0,              // }
+    0x7E, KEY_MOD_LALT,           KEY_5               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SK_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_sk_mac[] = {
+    0xA3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // £
+    0xA7, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // §
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // ¨
+    0xA9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // ©
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ¬
+    0xAE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ®
+    0xB6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ¶
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // »
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE1, 0x00, KEY_NONE,               KEY_8,              // á
+    0xE4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ä
+    0xE9, 0x00, KEY_NONE,               KEY_0,              // é
+    0xED, 0x00, KEY_NONE,               KEY_9,              // í
+    0xF4, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ô
+    0xF7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // ÷
+    0xFA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ú
+    0xFD, 0x00, KEY_NONE,               KEY_7,              // ý
+    0x04, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_LALT,           KEY_A,              // ą
+    0x0D, 0x01, KEY_NONE,               KEY_4,              // č
+    0x16, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Ė
+    0x17, 0x01, KEY_MOD_LALT,           KEY_W,              // ė
+    0x18, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_LALT,           KEY_E,              // ę
+    0x3E, 0x01, KEY_NONE,               KEY_2,              // ľ
+    0x41, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_LALT,           KEY_L,              // ł
+    0x48, 0x01, KEY_NONE,               KEY_BACKSLASH,      // ň
+    0x61, 0x01, KEY_NONE,               KEY_3,              // š
+    0x65, 0x01, KEY_NONE,               KEY_5,              // ť
+    0x7B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Ż
+    0x7C, 0x01, KEY_MOD_LALT,           KEY_Y,              // ż
+    0x7E, 0x01, KEY_NONE,               KEY_6,              // ž
+    0x13, 0x20, KEY_MOD_LALT,           KEY_SLASH,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_H,              // ‘
+    0x19, 0x20, KEY_MOD_LALT,           KEY_J,              // ’
+    0x1A, 0x20, KEY_MOD_LALT,           KEY_N,              // ‚
+    0x1C, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // „
+    0x20, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // †
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // •
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ›
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_R,              // €
+    0x22, 0x21, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // ∆
+    0x11, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // ∑
+    0x1A, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // √
+    0x60, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_GRAVE,          // ≤
+    0x65, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5               // ◊
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SK_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_sk_mac[] = {
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_MINUS,          KEY_NONE,               KEY_SPACE,          // °
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDC, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ö
+    0xFC, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ü
+    0x06, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_C,              // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0E, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_D,              // ď
+    0x1A, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // ě
+    0x39, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ĺ
+    0x3A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_L,              // ĺ
+    0x3B, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_L,              // Ļ
+    0x3C, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_L,              // ļ
+    0x3D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ľ
+    0x43, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_N,              // ń
+    0x45, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_N,              // Ņ
+    0x46, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_N,              // ņ
+    0x47, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x50, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ő
+    0x54, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ŕ
+    0x55, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_R,              // ŕ
+    0x56, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_R,              // Ŗ
+    0x57, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_R,              // ŗ
+    0x58, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x59, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_R,              // ř
+    0x5A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_S,              // ś
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Š
+    0x64, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x6E, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ů
+    0x6F, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ů
+    0x70, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ű
+    0x72, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_U,              // Ų
+    0x73, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_U,              // ų
+    0x79, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ź
+    0x7A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ź
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ž
+    0xC7, 0x02, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE           // ˇ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SK_MAC)
+inline constexpr hid_locale_t locale_sk_mac {
+    ascii_sk_mac, sizeof(ascii_sk_mac) / 3,
+    utf8_sk_mac, sizeof(utf8_sk_mac) / 4,
+    combinations_sk_mac, sizeof(combinations_sk_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_TR_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_tr_mac[] = {
+    0x22, KEY_NONE,               KEY_GRAVE,          // "
+    0x23, KEY_MOD_LALT,           KEY_3,              // #
+    0x24, KEY_MOD_LALT,           KEY_4,              // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_2,              // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_NONE,               KEY_MINUS,          // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_4,              // +
+    0x2C, KEY_NONE,               KEY_BACKSLASH,      // ,
+    0x2D, KEY_NONE,               KEY_EQUAL,          // -
+    0x2E, KEY_NONE,               KEY_SLASH,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_SLASH,          // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_LALT,           KEY_Q,              // @
+    0x5B, KEY_MOD_LALT,           KEY_8,              // [
+    0x5C, KEY_MOD_LALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_9,              // ]
+    0x5E, KEY_MOD_LALT,           KEY_H,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_EQUAL,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x69, KEY_NONE,               KEY_APOSTROPHE,     // i
+    0x7B, KEY_MOD_LALT,           KEY_7,              // {
+    0x7C, KEY_MOD_LALT,           KEY_EQUAL,          // |
+    0x7D, KEY_MOD_LALT,           KEY_0,              // }
+    0x7E, KEY_MOD_LALT,           KEY_N               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_TR_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_tr_mac[] = {
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_2,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_MOD_LALT,           KEY_6,              // §
+    0xA8, 0x00, KEY_MOD_LALT,           KEY_K,              // ¨
+    0xA9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ©
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ·
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xBD, 0x00, KEY_MOD_LALT,           KEY_5,              // ½
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Á
+    0xC2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // Â
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Æ
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_DOT,            // Ç
+    0xCA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Ê
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Î
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_COMMA,          // Ö
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // Ø
+    0xD9, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // Ù
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ú
+    0xDB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ü
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_A,              // æ
+    0xE7, 0x00, KEY_NONE,               KEY_DOT,            // ç
+    0xE9, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // é
+    0xF6, 0x00, KEY_NONE,               KEY_COMMA,          // ö
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xF8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ø
+    0xFC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ü
+    0x1E, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ğ
+    0x1F, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // ğ
+    0x30, 0x01, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // İ
+    0x31, 0x01, KEY_NONE,               KEY_I,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x5E, 0x01, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ş
+    0x5F, 0x01, KEY_NONE,               KEY_SEMICOLON,      // ş
+    0x78, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // Ÿ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˆ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ˘
+    0xD9, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ˙
+    0xDA, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ˚
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // ˜
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ‚
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // „
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ‡
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ‰
+    0xAC, 0x20, KEY_MOD_LALT,           KEY_E,              // €
+    0xBA, 0x20, KEY_MOD_LALT,           KEY_T,              // ₺
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K               // 
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_TR_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_tr_mac[] = {
+    0x60, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_SPACE,          // `
+    0xB4, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCB, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xE0, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_A,              // â
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xF2, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_TR_MAC)
+inline constexpr hid_locale_t locale_tr_mac {
+    ascii_tr_mac, sizeof(ascii_tr_mac) / 3,
+    utf8_tr_mac, sizeof(utf8_tr_mac) / 4,
+    combinations_tr_mac, sizeof(combinations_tr_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_UA_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ua_mac[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_LALT,           KEY_3,              // #
+    0x24, KEY_MOD_LALT,           KEY_4,              // $
+    0x26, KEY_MOD_LALT,           KEY_7,              // &
+    0x27, KEY_NONE,               KEY_YEN,            // '
+    0x2C, KEY_MOD_LSHIFT,         KEY_SLASH,          // ,
+    0x2E, KEY_NONE,               KEY_SLASH,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_GRAVE,          // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_6,              // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_4,              // ;
+    0x3C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // <
+    0x3E, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_7,              // ?
+    0x40, KEY_MOD_LALT,           KEY_2,              // @
+    0x41, KEY_NONE,               KEY_NONE,           // A
+    0x42, KEY_NONE,               KEY_NONE,           // B
+    0x43, KEY_NONE,               KEY_NONE,           // C
+    0x44, KEY_NONE,               KEY_NONE,           // D
+    0x45, KEY_NONE,               KEY_NONE,           // E
+    0x46, KEY_NONE,               KEY_NONE,           // F
+    0x47, KEY_NONE,               KEY_NONE,           // G
+    0x48, KEY_NONE,               KEY_NONE,           // H
+    0x49, KEY_NONE,               KEY_NONE,           // I
+    0x4A, KEY_NONE,               KEY_NONE,           // J
+    0x4B, KEY_NONE,               KEY_NONE,           // K
+    0x4C, KEY_NONE,               KEY_NONE,           // L
+    0x4D, KEY_NONE,               KEY_NONE,           // M
+    0x4E, KEY_NONE,               KEY_NONE,           // N
+    0x4F, KEY_NONE,               KEY_NONE,           // O
+    0x50, KEY_NONE,               KEY_NONE,           // P
+    0x51, KEY_NONE,               KEY_NONE,           // Q
+    0x52, KEY_NONE,               KEY_NONE,           // R
+    0x53, KEY_NONE,               KEY_NONE,           // S
+    0x54, KEY_NONE,               KEY_NONE,           // T
+    0x55, KEY_NONE,               KEY_NONE,           // U
+    0x56, KEY_NONE,               KEY_NONE,           // V
+    0x57, KEY_NONE,               KEY_NONE,           // W
+    0x58, KEY_NONE,               KEY_NONE,           // X
+    0x59, KEY_NONE,               KEY_NONE,           // Y
+    0x5A, KEY_NONE,               KEY_NONE,           // Z
+    0x5B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_102ND,          // [
+    0x5C, KEY_NONE,               KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_LALT,           KEY_102ND,          // ]
+    0x5E, KEY_MOD_LALT,           KEY_6,              // ^
+    0x60, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // `
+    0x61, KEY_NONE,               KEY_NONE,           // a
+    0x62, KEY_NONE,               KEY_NONE,           // b
+    0x63, KEY_NONE,               KEY_NONE,           // c
+    0x64, KEY_NONE,               KEY_NONE,           // d
+    0x65, KEY_NONE,               KEY_NONE,           // e
+    0x66, KEY_NONE,               KEY_NONE,           // f
+    0x67, KEY_NONE,               KEY_NONE,           // g
+    0x68, KEY_NONE,               KEY_NONE,           // h
+    0x69, KEY_NONE,               KEY_NONE,           // i
+    0x6A, KEY_NONE,               KEY_NONE,           // j
+    0x6B, KEY_NONE,               KEY_NONE,           // k
+    0x6C, KEY_NONE,               KEY_NONE,           // l
+    0x6D, KEY_NONE,               KEY_NONE,           // m
+    0x6E, KEY_NONE,               KEY_NONE,           // n
+    0x6F, KEY_NONE,               KEY_NONE,           // o
+    0x70, KEY_NONE,               KEY_NONE,           // p
+    0x71, KEY_NONE,               KEY_NONE,           // q
+    0x72, KEY_NONE,               KEY_NONE,           // r
+    0x73, KEY_NONE,               KEY_NONE,           // s
+    0x74, KEY_NONE,               KEY_NONE,           // t
+    0x75, KEY_NONE,               KEY_NONE,           // u
+    0x76, KEY_NONE,               KEY_NONE,           // v
+    0x77, KEY_NONE,               KEY_NONE,           // w
+    0x78, KEY_NONE,               KEY_NONE,           // x
+    0x79, KEY_NONE,               KEY_NONE,           // y
+    0x7A, KEY_NONE,               KEY_NONE,           // z
+    0x7B, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // {
+    0x7C, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // |
+    0x7D, KEY_MOD_LALT,           KEY_H,              // }
+    0x7E, KEY_MOD_LALT,           KEY_M               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_UA_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ua_mac[] = {
+    0xA3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // £
+    0xA7, 0x00, KEY_MOD_LALT,           KEY_GRAVE,          // §
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // «
+    0xAC, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xB0, 0x00, KEY_MOD_LALT,           KEY_J,              // °
+    0xB1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_GRAVE,          // ±
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_V,              // µ
+    0xB6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ¶
+    0xBB, 0x00, KEY_MOD_LALT,           KEY_EQUAL,          // »
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_F,              // ÷
+    0x92, 0x01, KEY_MOD_LALT,           KEY_A,              // ƒ
+    0xBC, 0x02, KEY_NONE,               KEY_BACKSLASH,      // ʼ
+    0x01, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // Ё
+    0x02, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // Ђ
+    0x04, 0x04, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Є
+    0x05, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // Ѕ
+    0x06, 0x04, KEY_MOD_LSHIFT,         KEY_S,              // І
+    0x07, 0x04, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ї
+    0x08, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Ј
+    0x09, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // Љ
+    0x0A, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Њ
+    0x0B, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Ћ
+    0x0C, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // Ќ
+    0x0E, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ў
+    0x0F, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // Џ
+    0x10, 0x04, KEY_MOD_LSHIFT,         KEY_F,              // А
+    0x11, 0x04, KEY_MOD_LSHIFT,         KEY_COMMA,          // Б
+    0x12, 0x04, KEY_MOD_LSHIFT,         KEY_D,              // В
+    0x13, 0x04, KEY_MOD_LSHIFT,         KEY_U,              // Г
+    0x14, 0x04, KEY_MOD_LSHIFT,         KEY_L,              // Д
+    0x15, 0x04, KEY_MOD_LSHIFT,         KEY_T,              // Е
+    0x16, 0x04, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ж
+    0x17, 0x04, KEY_MOD_LSHIFT,         KEY_P,              // З
+    0x18, 0x04, KEY_MOD_LSHIFT,         KEY_B,              // И
+    0x19, 0x04, KEY_MOD_LSHIFT,         KEY_Q,              // Й
+    0x1A, 0x04, KEY_MOD_LSHIFT,         KEY_R,              // К
+    0x1B, 0x04, KEY_MOD_LSHIFT,         KEY_K,              // Л
+    0x1C, 0x04, KEY_MOD_LSHIFT,         KEY_V,              // М
+    0x1D, 0x04, KEY_MOD_LSHIFT,         KEY_Y,              // Н
+    0x1E, 0x04, KEY_MOD_LSHIFT,         KEY_J,              // О
+    0x1F, 0x04, KEY_MOD_LSHIFT,         KEY_G,              // П
+    0x20, 0x04, KEY_MOD_LSHIFT,         KEY_H,              // Р
+    0x21, 0x04, KEY_MOD_LSHIFT,         KEY_C,              // С
+    0x22, 0x04, KEY_MOD_LSHIFT,         KEY_N,              // Т
+    0x23, 0x04, KEY_MOD_LSHIFT,         KEY_E,              // У
+    0x24, 0x04, KEY_MOD_LSHIFT,         KEY_A,              // Ф
+    0x25, 0x04, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Х
+    0x26, 0x04, KEY_MOD_LSHIFT,         KEY_W,              // Ц
+    0x27, 0x04, KEY_MOD_LSHIFT,         KEY_X,              // Ч
+    0x28, 0x04, KEY_MOD_LSHIFT,         KEY_I,              // Ш
+    0x29, 0x04, KEY_MOD_LSHIFT,         KEY_O,              // Щ
+    0x2A, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // Ъ
+    0x2B, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Ы
+    0x2C, 0x04, KEY_MOD_LSHIFT,         KEY_M,              // Ь
+    0x2D, 0x04, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Э
+    0x2E, 0x04, KEY_MOD_LSHIFT,         KEY_DOT,            // Ю
+    0x2F, 0x04, KEY_MOD_LSHIFT,         KEY_Z,              // Я
+    0x30, 0x04, KEY_NONE,               KEY_F,              // а
+    0x31, 0x04, KEY_NONE,               KEY_COMMA,          // б
+    0x32, 0x04, KEY_NONE,               KEY_D,              // в
+    0x33, 0x04, KEY_NONE,               KEY_U,              // г
+    0x34, 0x04, KEY_NONE,               KEY_L,              // д
+    0x35, 0x04, KEY_NONE,               KEY_T,              // е
+    0x36, 0x04, KEY_NONE,               KEY_SEMICOLON,      // ж
+    0x37, 0x04, KEY_NONE,               KEY_P,              // з
+    0x38, 0x04, KEY_NONE,               KEY_B,              // и
+    0x39, 0x04, KEY_NONE,               KEY_Q,              // й
+    0x3A, 0x04, KEY_NONE,               KEY_R,              // к
+    0x3B, 0x04, KEY_NONE,               KEY_K,              // л
+    0x3C, 0x04, KEY_NONE,               KEY_V,              // м
+    0x3D, 0x04, KEY_NONE,               KEY_Y,              // н
+    0x3E, 0x04, KEY_NONE,               KEY_J,              // о
+    0x3F, 0x04, KEY_NONE,               KEY_G,              // п
+    0x40, 0x04, KEY_NONE,               KEY_H,              // р
+    0x41, 0x04, KEY_NONE,               KEY_C,              // с
+    0x42, 0x04, KEY_NONE,               KEY_N,              // т
+    0x43, 0x04, KEY_NONE,               KEY_E,              // у
+    0x44, 0x04, KEY_NONE,               KEY_A,              // ф
+    0x45, 0x04, KEY_NONE,               KEY_LEFTBRACE,      // х
+    0x46, 0x04, KEY_NONE,               KEY_W,              // ц
+    0x47, 0x04, KEY_NONE,               KEY_X,              // ч
+    0x48, 0x04, KEY_NONE,               KEY_I,              // ш
+    0x49, 0x04, KEY_NONE,               KEY_O,              // щ
+    0x4A, 0x04, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ъ
+    0x4B, 0x04, KEY_MOD_LALT,           KEY_S,              // ы
+    0x4C, 0x04, KEY_NONE,               KEY_M,              // ь
+    0x4D, 0x04, KEY_MOD_LALT,           KEY_APOSTROPHE,     // э
+    0x4E, 0x04, KEY_NONE,               KEY_DOT,            // ю
+    0x4F, 0x04, KEY_NONE,               KEY_Z,              // я
+    0x51, 0x04, KEY_MOD_LALT,           KEY_T,              // ё
+    0x52, 0x04, KEY_MOD_LALT,           KEY_Z,              // ђ
+    0x54, 0x04, KEY_NONE,               KEY_APOSTROPHE,     // є
+    0x55, 0x04, KEY_MOD_LALT,           KEY_I,              // ѕ
+    0x56, 0x04, KEY_NONE,               KEY_S,              // і
+    0x57, 0x04, KEY_NONE,               KEY_RIGHTBRACE,     // ї
+    0x58, 0x04, KEY_MOD_LALT,           KEY_Q,              // ј
+    0x59, 0x04, KEY_MOD_LALT,           KEY_K,              // љ
+    0x5A, 0x04, KEY_MOD_LALT,           KEY_Y,              // њ
+    0x5B, 0x04, KEY_MOD_LALT,           KEY_D,              // ћ
+    0x5C, 0x04, KEY_MOD_LALT,           KEY_E,              // ќ
+    0x5E, 0x04, KEY_MOD_LALT,           KEY_O,              // ў
+    0x5F, 0x04, KEY_MOD_LALT,           KEY_W,              // џ
+    0x90, 0x04, KEY_MOD_LSHIFT,         KEY_102ND,          // Ґ
+    0x91, 0x04, KEY_NONE,               KEY_102ND,          // ґ
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_P,              // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ’
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // „
+    0x22, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0xAC, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // €
+    0xB4, 0x20, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // ₴
+    0x16, 0x21, KEY_MOD_LSHIFT,         KEY_3,              // №
+    0x22, 0x21, KEY_MOD_LALT,           KEY_N,              // ™
+    0x06, 0x22, KEY_MOD_LALT,           KEY_L,              // ∆
+    0x1A, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // √
+    0x1E, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ∞
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_C,              // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT             // ≥
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_UA_MAC)
+inline constexpr hid_locale_t locale_ua_mac {
+    ascii_ua_mac, sizeof(ascii_ua_mac) / 3,
+    utf8_ua_mac, sizeof(utf8_ua_mac) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_US_MAC)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_us_mac[] = {
+    0x60, KEY_NONE,               KEY_NONE,           // `
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_US_MAC)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_us_mac[] = {
+    0xA0, 0x00, KEY_MOD_LALT,           KEY_SPACE,
+    0xA1, 0x00, KEY_MOD_LALT,           KEY_1,              // ¡
+    0xA2, 0x00, KEY_MOD_LALT,           KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_LALT,           KEY_3,              // £
+    0xA5, 0x00, KEY_MOD_LALT,           KEY_Y,              // ¥
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xA8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_U,              // ¨
+    0xA9, 0x00, KEY_MOD_LALT,           KEY_G,              // ©
+    0xAA, 0x00, KEY_MOD_LALT,           KEY_9,              // ª
+    0xAB, 0x00, KEY_MOD_LALT,           KEY_BACKSLASH,      // «
+    0xAC, 0x00, KEY_MOD_LALT,           KEY_L,              // ¬
+    0xAE, 0x00, KEY_MOD_LALT,           KEY_R,              // ®
+    0xAF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_COMMA,          // ¯
+    0xB0, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_8,              // °
+    0xB1, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ±
+    0xB4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_E,              // ´
+    0xB5, 0x00, KEY_MOD_LALT,           KEY_M,              // µ
+    0xB6, 0x00, KEY_MOD_LALT,           KEY_7,              // ¶
+    0xB7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_9,              // ·
+    0xB8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Z,              // ¸
+    0xBA, 0x00, KEY_MOD_LALT,           KEY_0,              // º
+    0xBB, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // »
+    0xBF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SLASH,          // ¿
+    0xC1, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Y,              // Á
+    0xC2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_M,              // Â
+    0xC5, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_A,              // Å
+    0xC6, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // Æ
+    0xC7, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_C,              // Ç
+    0xCD, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_S,              // Í
+    0xCE, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_D,              // Î
+    0xCF, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_F,              // Ï
+    0xD2, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_L,              // Ò
+    0xD3, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_H,              // Ó
+    0xD4, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_J,              // Ô
+    0xD8, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_O,              // Ø
+    0xDA, 0x00, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // Ú
+    0xDF, 0x00, KEY_MOD_LALT,           KEY_S,              // ß
+    0xE5, 0x00, KEY_MOD_LALT,           KEY_A,              // å
+    0xE6, 0x00, KEY_MOD_LALT,           KEY_APOSTROPHE,     // æ
+    0xE7, 0x00, KEY_MOD_LALT,           KEY_C,              // ç
+    0xF7, 0x00, KEY_MOD_LALT,           KEY_SLASH,          // ÷
+    0xF8, 0x00, KEY_MOD_LALT,           KEY_O,              // ø
+    0x31, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_B,              // ı
+    0x52, 0x01, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_Q,              // Œ
+    0x53, 0x01, KEY_MOD_LALT,           KEY_Q,              // œ
+    0x92, 0x01, KEY_MOD_LALT,           KEY_F,              // ƒ
+    0xC6, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_I,              // ˆ
+    0xC7, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_T,              // ˇ
+    0xD8, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_DOT,            // ˘
+    0xD9, 0x02, KEY_MOD_LALT,           KEY_H,              // ˙
+    0xDA, 0x02, KEY_MOD_LALT,           KEY_K,              // ˚
+    0xDB, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_X,              // ˛
+    0xDC, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_N,              // ˜
+    0xDD, 0x02, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_G,              // ˝
+    0xA9, 0x03, KEY_MOD_LALT,           KEY_Z,              // Ω
+    0xC0, 0x03, KEY_MOD_LALT,           KEY_P,              // π
+    0x13, 0x20, KEY_MOD_LALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x18, 0x20, KEY_MOD_LALT,           KEY_RIGHTBRACE,     // ‘
+    0x19, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // ’
+    0x1A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_0,              // ‚
+    0x1C, 0x20, KEY_MOD_LALT,           KEY_LEFTBRACE,      // “
+    0x1D, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // ”
+    0x1E, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_W,              // „
+    0x20, 0x20, KEY_MOD_LALT,           KEY_T,              // †
+    0x21, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_7,              // ‡
+    0x22, 0x20, KEY_MOD_LALT,           KEY_8,              // •
+    0x26, 0x20, KEY_MOD_LALT,           KEY_SEMICOLON,      // …
+    0x30, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_R,              // ‰
+    0x39, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_3,              // ‹
+    0x3A, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_4,              // ›
+    0x44, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_1,              // ⁄
+    0xAC, 0x20, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_2,              // €
+    0x22, 0x21, KEY_MOD_LALT,           KEY_2,              // ™
+    0x02, 0x22, KEY_MOD_LALT,           KEY_D,              // ∂
+    0x06, 0x22, KEY_MOD_LALT,           KEY_J,              // ∆
+    0x0F, 0x22, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_P,              // ∏
+    0x11, 0x22, KEY_MOD_LALT,           KEY_W,              // ∑
+    0x1A, 0x22, KEY_MOD_LALT,           KEY_V,              // √
+    0x1E, 0x22, KEY_MOD_LALT,           KEY_5,              // ∞
+    0x2B, 0x22, KEY_MOD_LALT,           KEY_B,              // ∫
+    0x48, 0x22, KEY_MOD_LALT,           KEY_X,              // ≈
+    0x60, 0x22, KEY_MOD_LALT,           KEY_EQUAL,          // ≠
+    0x64, 0x22, KEY_MOD_LALT,           KEY_COMMA,          // ≤
+    0x65, 0x22, KEY_MOD_LALT,           KEY_DOT,            // ≥
+    0xCA, 0x25, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_V,              // ◊
+    0xFF, 0xF8, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_K,              // 
+    0x01, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_5,              // ﬁ
+    0x02, 0xFB, (KEY_MOD_LALT|KEY_MOD_LSHIFT), KEY_6               // ﬂ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_US_MAC)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_us_mac[] = {
+    0xC3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xCA, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xD5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDB, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE1, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_A,              // ä
+    0xEA, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_E,              // ë
+    0xED, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_I,              // í
+    0xEF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_I,              // ï
+    0xF3, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_LALT,           KEY_N,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_O,              // ö
+    0xFA, 0x00, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LALT,           KEY_I,              KEY_NONE,               KEY_U,              // û
+    0xFF, 0x00, KEY_MOD_LALT,           KEY_U,              KEY_NONE,               KEY_Y,              // ÿ
+    0x78, 0x01, KEY_MOD_LALT,           KEY_U,              KEY_MOD_LSHIFT,         KEY_Y,              // Ÿ
+    0x01, 0x03, KEY_MOD_LALT,           KEY_E,              KEY_NONE,               KEY_J               // ́
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_US_MAC)
+inline constexpr hid_locale_t locale_us_mac {
+    ascii_us_mac, sizeof(ascii_us_mac) / 3,
+    utf8_us_mac, sizeof(utf8_us_mac) / 4,
+    combinations_us_mac, sizeof(combinations_us_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BE)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_be_win[] = {
+    0x21, KEY_NONE,               KEY_8,              // !
+    0x22, KEY_NONE,               KEY_3,              // "
+    0x23, KEY_MOD_RALT,           KEY_3,              // #
+    0x24, KEY_NONE,               KEY_RIGHTBRACE,     // $
+    0x25, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // %
+    0x26, KEY_NONE,               KEY_1,              // &
+    0x27, KEY_NONE,               KEY_4,              // '
+    0x28, KEY_NONE,               KEY_5,              // (
+    0x29, KEY_NONE,               KEY_MINUS,          // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_SLASH,          // +
+    0x2C, KEY_NONE,               KEY_M,              // ,
+    0x2D, KEY_NONE,               KEY_EQUAL,          // -
+    0x2E, KEY_MOD_LSHIFT,         KEY_COMMA,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_DOT,            // /
+    0x30, KEY_MOD_LSHIFT,         KEY_0,              // 0
+    0x31, KEY_MOD_LSHIFT,         KEY_1,              // 1
+    0x32, KEY_MOD_LSHIFT,         KEY_2,              // 2
+    0x33, KEY_MOD_LSHIFT,         KEY_3,              // 3
+    0x34, KEY_MOD_LSHIFT,         KEY_4,              // 4
+    0x35, KEY_MOD_LSHIFT,         KEY_5,              // 5
+    0x36, KEY_MOD_LSHIFT,         KEY_6,              // 6
+    0x37, KEY_MOD_LSHIFT,         KEY_7,              // 7
+    0x38, KEY_MOD_LSHIFT,         KEY_8,              // 8
+    0x39, KEY_MOD_LSHIFT,         KEY_9,              // 9
+    0x3A, KEY_NONE,               KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_NONE,               KEY_SLASH,          // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_M,              // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x41, KEY_MOD_LSHIFT,         KEY_Q,              // A
+    0x4D, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // M
+    0x51, KEY_MOD_LSHIFT,         KEY_A,              // Q
+    0x57, KEY_MOD_LSHIFT,         KEY_Z,              // W
+    0x5A, KEY_MOD_LSHIFT,         KEY_W,              // Z
+    0x5B, KEY_MOD_RALT,           KEY_5,              // [
+    0x5C, KEY_MOD_RALT,           KEY_102ND,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_MOD_RALT,           KEY_6,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_EQUAL,          // _
+    0x60, KEY_MOD_RALT,           KEY_BACKSLASH,      // `
+    0x61, KEY_NONE,               KEY_Q,              // a
+    0x6D, KEY_NONE,               KEY_SEMICOLON,      // m
+    0x71, KEY_NONE,               KEY_A,              // q
+    0x77, KEY_NONE,               KEY_Z,              // w
+    0x7A, KEY_NONE,               KEY_W,              // z
+    0x7B, KEY_MOD_RALT,           KEY_4,              // {
+    0x7C, KEY_MOD_RALT,           KEY_1,              // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BE)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_be_win[] = {
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // £
+    0xA7, 0x00, KEY_NONE,               KEY_6,              // §
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_MINUS,          // °
+    0xB2, 0x00, KEY_NONE,               KEY_GRAVE,          // ²
+    0xB3, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ³
+    0xB5, 0x00, KEY_NONE,               KEY_BACKSLASH,      // µ
+    0xE0, 0x00, KEY_NONE,               KEY_0,              // à
+    0xE7, 0x00, KEY_NONE,               KEY_9,              // ç
+    0xE8, 0x00, KEY_NONE,               KEY_7,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_2,              // é
+    0xF9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ù
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BE)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_be_win[] = {
+    0x7E, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_Q,              // À
+    0xC1, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Q,              // Á
+    0xC2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Q,              // Â
+    0xC3, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_MOD_LSHIFT,         KEY_Q,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Q,              // Ä
+    0xC8, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD1, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_Q,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_Q,              // â
+    0xE3, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_Q,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Q,              // ä
+    0xEA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BE)
+inline constexpr hid_locale_t locale_be_win {
+    ascii_be_win, sizeof(ascii_be_win) / 3,
+    utf8_be_win, sizeof(utf8_be_win) / 4,
+    combinations_be_win, sizeof(combinations_be_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BG)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_bg_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_4,              // "
+    0x23, KEY_NONE,               KEY_NONE,           // #
+    0x24, KEY_MOD_LSHIFT,         KEY_MINUS,          // $
+    0x26, KEY_NONE,               KEY_NONE,           // &
+    0x27, KEY_NONE,               KEY_NONE,           // '
+    0x28, KEY_NONE,               KEY_GRAVE,          // (
+    0x29, KEY_MOD_LSHIFT,         KEY_GRAVE,          // )
+    0x2A, KEY_NONE,               KEY_NONE,           // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_3,              // +
+    0x2C, KEY_NONE,               KEY_Q,              // ,
+    0x2E, KEY_NONE,               KEY_EQUAL,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_8,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_7,              // :
+    0x3B, KEY_NONE,               KEY_RIGHTBRACE,     // ;
+    0x3C, KEY_NONE,               KEY_NONE,           // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_6,              // =
+    0x3E, KEY_NONE,               KEY_NONE,           // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_2,              // ?
+    0x40, KEY_NONE,               KEY_NONE,           // @
+    0x41, KEY_NONE,               KEY_NONE,           // A
+    0x42, KEY_NONE,               KEY_NONE,           // B
+    0x43, KEY_NONE,               KEY_NONE,           // C
+    0x44, KEY_NONE,               KEY_NONE,           // D
+    0x45, KEY_NONE,               KEY_NONE,           // E
+    0x46, KEY_NONE,               KEY_NONE,           // F
+    0x47, KEY_NONE,               KEY_NONE,           // G
+    0x48, KEY_NONE,               KEY_NONE,           // H
+    0x49, KEY_NONE,               KEY_NONE,           // I
+    0x4A, KEY_NONE,               KEY_NONE,           // J
+    0x4B, KEY_NONE,               KEY_NONE,           // K
+    0x4C, KEY_NONE,               KEY_NONE,           // L
+    0x4D, KEY_NONE,               KEY_NONE,           // M
+    0x4E, KEY_NONE,               KEY_NONE,           // N
+    0x4F, KEY_NONE,               KEY_NONE,           // O
+    0x50, KEY_NONE,               KEY_NONE,           // P
+    0x51, KEY_NONE,               KEY_NONE,           // Q
+    0x52, KEY_NONE,               KEY_NONE,           // R
+    0x53, KEY_NONE,               KEY_NONE,           // S
+    0x54, KEY_NONE,               KEY_NONE,           // T
+    0x55, KEY_NONE,               KEY_NONE,           // U
+    0x56, KEY_NONE,               KEY_NONE,           // V
+    0x57, KEY_NONE,               KEY_NONE,           // W
+    0x58, KEY_NONE,               KEY_NONE,           // X
+    0x59, KEY_NONE,               KEY_NONE,           // Y
+    0x5A, KEY_NONE,               KEY_NONE,           // Z
+    0x5B, KEY_NONE,               KEY_NONE,           // [
+    0x5C, KEY_NONE,               KEY_NONE,           // bslash
+    0x5D, KEY_NONE,               KEY_NONE,           // ]
+    0x5E, KEY_NONE,               KEY_NONE,           // ^
+    0x5F, KEY_NONE,               KEY_NONE,           // _
+    0x60, KEY_NONE,               KEY_NONE,           // `
+    0x61, KEY_NONE,               KEY_NONE,           // a
+    0x62, KEY_NONE,               KEY_NONE,           // b
+    0x63, KEY_NONE,               KEY_NONE,           // c
+    0x64, KEY_NONE,               KEY_NONE,           // d
+    0x65, KEY_NONE,               KEY_NONE,           // e
+    0x66, KEY_NONE,               KEY_NONE,           // f
+    0x67, KEY_NONE,               KEY_NONE,           // g
+    0x68, KEY_NONE,               KEY_NONE,           // h
+    0x69, KEY_NONE,               KEY_NONE,           // i
+    0x6A, KEY_NONE,               KEY_NONE,           // j
+    0x6B, KEY_NONE,               KEY_NONE,           // k
+    0x6C, KEY_NONE,               KEY_NONE,           // l
+    0x6D, KEY_NONE,               KEY_NONE,           // m
+    0x6E, KEY_NONE,               KEY_NONE,           // n
+    0x6F, KEY_NONE,               KEY_NONE,           // o
+    0x70, KEY_NONE,               KEY_NONE,           // p
+    0x71, KEY_NONE,               KEY_NONE,           // q
+    0x72, KEY_NONE,               KEY_NONE,           // r
+    0x73, KEY_NONE,               KEY_NONE,           // s
+    0x74, KEY_NONE,               KEY_NONE,           // t
+    0x75, KEY_NONE,               KEY_NONE,           // u
+    0x76, KEY_NONE,               KEY_NONE,           // v
+    0x77, KEY_NONE,               KEY_NONE,           // w
+    0x78, KEY_NONE,               KEY_NONE,           // x
+    0x79, KEY_NONE,               KEY_NONE,           // y
+    0x7A, KEY_NONE,               KEY_NONE,           // z
+    0x7B, KEY_NONE,               KEY_NONE,           // {
+    0x7C, KEY_NONE,               KEY_NONE,           // |
+    0x7D, KEY_NONE,               KEY_NONE,           // }
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BG)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_bg_win[] = {
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // §
+    0x0D, 0x04, KEY_MOD_LSHIFT,         KEY_102ND,          // Ѝ
+    0x10, 0x04, KEY_MOD_LSHIFT,         KEY_D,              // А
+    0x11, 0x04, KEY_MOD_LSHIFT,         KEY_SLASH,          // Б
+    0x12, 0x04, KEY_MOD_LSHIFT,         KEY_L,              // В
+    0x13, 0x04, KEY_MOD_LSHIFT,         KEY_H,              // Г
+    0x14, 0x04, KEY_MOD_LSHIFT,         KEY_O,              // Д
+    0x15, 0x04, KEY_MOD_LSHIFT,         KEY_E,              // Е
+    0x16, 0x04, KEY_MOD_LSHIFT,         KEY_G,              // Ж
+    0x17, 0x04, KEY_MOD_LSHIFT,         KEY_P,              // З
+    0x18, 0x04, KEY_MOD_LSHIFT,         KEY_R,              // И
+    0x19, 0x04, KEY_MOD_LSHIFT,         KEY_X,              // Й
+    0x1A, 0x04, KEY_MOD_LSHIFT,         KEY_U,              // К
+    0x1B, 0x04, KEY_MOD_LSHIFT,         KEY_DOT,            // Л
+    0x1C, 0x04, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // М
+    0x1D, 0x04, KEY_MOD_LSHIFT,         KEY_K,              // Н
+    0x1E, 0x04, KEY_MOD_LSHIFT,         KEY_F,              // О
+    0x1F, 0x04, KEY_MOD_LSHIFT,         KEY_M,              // П
+    0x20, 0x04, KEY_MOD_LSHIFT,         KEY_COMMA,          // Р
+    0x21, 0x04, KEY_MOD_LSHIFT,         KEY_I,              // С
+    0x22, 0x04, KEY_MOD_LSHIFT,         KEY_J,              // Т
+    0x23, 0x04, KEY_MOD_LSHIFT,         KEY_W,              // У
+    0x24, 0x04, KEY_MOD_LSHIFT,         KEY_B,              // Ф
+    0x25, 0x04, KEY_MOD_LSHIFT,         KEY_N,              // Х
+    0x26, 0x04, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ц
+    0x27, 0x04, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ч
+    0x28, 0x04, KEY_MOD_LSHIFT,         KEY_T,              // Ш
+    0x29, 0x04, KEY_MOD_LSHIFT,         KEY_Y,              // Щ
+    0x2A, 0x04, KEY_MOD_LSHIFT,         KEY_C,              // Ъ
+    0x2D, 0x04, KEY_MOD_LSHIFT,         KEY_V,              // Э
+    0x2E, 0x04, KEY_MOD_LSHIFT,         KEY_Z,              // Ю
+    0x2F, 0x04, KEY_MOD_LSHIFT,         KEY_S,              // Я
+    0x30, 0x04, KEY_NONE,               KEY_D,              // а
+    0x31, 0x04, KEY_NONE,               KEY_SLASH,          // б
+    0x32, 0x04, KEY_NONE,               KEY_L,              // в
+    0x33, 0x04, KEY_NONE,               KEY_H,              // г
+    0x34, 0x04, KEY_NONE,               KEY_O,              // д
+    0x35, 0x04, KEY_NONE,               KEY_E,              // е
+    0x36, 0x04, KEY_NONE,               KEY_G,              // ж
+    0x37, 0x04, KEY_NONE,               KEY_P,              // з
+    0x38, 0x04, KEY_NONE,               KEY_R,              // и
+    0x39, 0x04, KEY_NONE,               KEY_X,              // й
+    0x3A, 0x04, KEY_NONE,               KEY_U,              // к
+    0x3B, 0x04, KEY_NONE,               KEY_DOT,            // л
+    0x3C, 0x04, KEY_NONE,               KEY_SEMICOLON,      // м
+    0x3D, 0x04, KEY_NONE,               KEY_K,              // н
+    0x3E, 0x04, KEY_NONE,               KEY_F,              // о
+    0x3F, 0x04, KEY_NONE,               KEY_M,              // п
+    0x40, 0x04, KEY_NONE,               KEY_COMMA,          // р
+    0x41, 0x04, KEY_NONE,               KEY_I,              // с
+    0x42, 0x04, KEY_NONE,               KEY_J,              // т
+    0x43, 0x04, KEY_NONE,               KEY_W,              // у
+    0x44, 0x04, KEY_NONE,               KEY_B,              // ф
+    0x45, 0x04, KEY_NONE,               KEY_N,              // х
+    0x46, 0x04, KEY_NONE,               KEY_LEFTBRACE,      // ц
+    0x47, 0x04, KEY_NONE,               KEY_APOSTROPHE,     // ч
+    0x48, 0x04, KEY_NONE,               KEY_T,              // ш
+    0x49, 0x04, KEY_NONE,               KEY_Y,              // щ
+    0x4A, 0x04, KEY_NONE,               KEY_C,              // ъ
+    0x4B, 0x04, KEY_MOD_LSHIFT,         KEY_Q,              // ы
+    0x4C, 0x04, KEY_NONE,               KEY_A,              // ь
+    0x4D, 0x04, KEY_NONE,               KEY_V,              // э
+    0x4E, 0x04, KEY_NONE,               KEY_Z,              // ю
+    0x4F, 0x04, KEY_NONE,               KEY_S,              // я
+    0x5D, 0x04, KEY_NONE,               KEY_102ND,          // ѝ
+    0x13, 0x20, KEY_MOD_LSHIFT,         KEY_9,              // –
+    0x1C, 0x20, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // “
+    0x1E, 0x20, KEY_NONE,               KEY_BACKSLASH,      // „
+    0xAC, 0x20, KEY_MOD_LSHIFT,         KEY_EQUAL,          // €
+    0x16, 0x21, KEY_MOD_LSHIFT,         KEY_0               // №
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_BG)
+inline constexpr hid_locale_t locale_bg_win {
+    ascii_bg_win, sizeof(ascii_bg_win) / 3,
+    utf8_bg_win, sizeof(utf8_bg_win) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_CMS)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ca_cms_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_DOT,            // "
+    0x27, KEY_MOD_LSHIFT,         KEY_COMMA,          // '
+    0x2F, KEY_NONE,               KEY_GRAVE,          // /
+    0x3C, KEY_MOD_RALT,           KEY_COMMA,          // <
+    0x3E, KEY_MOD_RALT,           KEY_DOT,            // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_6,              // ?
+    0x5B, KEY_MOD_RALT,           KEY_9,              // [
+    0x5C, KEY_MOD_LSHIFT,         KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_0,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_MOD_RALT,           KEY_GRAVE,          // |
+    0x7D, KEY_MOD_RALT,           KEY_8,              // }
+    0x7E, KEY_MOD_RALT,           KEY_RIGHTBRACE      // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_CMS)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ca_cms_win[] = {
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_4,              // ¤
+    0xAB, 0x00, KEY_MOD_RALT,           KEY_Z,              // «
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ¬
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      // °
+    0xBB, 0x00, KEY_MOD_RALT,           KEY_X,              // »
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // À
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ç
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // È
+    0xC9, 0x00, KEY_MOD_LSHIFT,         KEY_SLASH,          // É
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          // Ù
+    0xE0, 0x00, KEY_NONE,               KEY_BACKSLASH,      // à
+    0xE7, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ç
+    0xE8, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // è
+    0xE9, 0x00, KEY_NONE,               KEY_SLASH,          // é
+    0xF9, 0x00, KEY_NONE,               KEY_102ND,          // ù
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_CMS)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ca_cms_win[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // `
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xC2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xCA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // â
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // ä
+    0xEA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ì
+    0xEE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ò
+    0xF4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ô
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xFB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ü
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Y,              // ÿ
+    0x08, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_C,              // Ĉ
+    0x09, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_C,              // ĉ
+    0x1C, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_G,              // Ĝ
+    0x1D, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_G,              // ĝ
+    0x24, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_H,              // Ĥ
+    0x25, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_H,              // ĥ
+    0x34, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_J,              // Ĵ
+    0x35, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_J,              // ĵ
+    0x5C, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_S,              // Ŝ
+    0x5D, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_S,              // ŝ
+    0x74, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_W,              // Ŵ
+    0x75, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_W,              // ŵ
+    0x76, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Y,              // Ŷ
+    0x77, 0x01, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_Y,              // ŷ
+    0x78, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Y               // Ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_CMS)
+inline constexpr hid_locale_t locale_ca_cms_win {
+    ascii_ca_cms_win, sizeof(ascii_ca_cms_win) / 3,
+    utf8_ca_cms_win, sizeof(utf8_ca_cms_win) / 4,
+    combinations_ca_cms_win, sizeof(combinations_ca_cms_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ca_fr_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_NONE,               KEY_GRAVE,          // #
+    0x27, KEY_MOD_LSHIFT,         KEY_COMMA,          // '
+    0x2F, KEY_MOD_LSHIFT,         KEY_3,              // /
+    0x3C, KEY_NONE,               KEY_BACKSLASH,      // <
+    0x3E, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_6,              // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x5B, KEY_MOD_RALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_MOD_RALT,           KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_RALT,           KEY_APOSTROPHE,     // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_GRAVE,          // |
+    0x7D, KEY_MOD_RALT,           KEY_BACKSLASH,      // }
+    0x7E, KEY_MOD_RALT,           KEY_SEMICOLON       // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ca_fr_win[] = {
+    0xA2, 0x00, KEY_MOD_RALT,           KEY_4,              // ¢
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_3,              // £
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_5,              // ¤
+    0xA6, 0x00, KEY_MOD_RALT,           KEY_7,              // ¦
+    0xA7, 0x00, KEY_MOD_RALT,           KEY_O,              // §
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // ¨
+    0xAB, 0x00, KEY_NONE,               KEY_102ND,          // «
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_6,              // ¬
+    0xAD, 0x00, KEY_MOD_RALT,           KEY_DOT,            // ­
+    0xAF, 0x00, KEY_MOD_RALT,           KEY_COMMA,          // ¯
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_102ND,          // °
+    0xB1, 0x00, KEY_MOD_RALT,           KEY_1,              // ±
+    0xB2, 0x00, KEY_MOD_RALT,           KEY_8,              // ²
+    0xB3, 0x00, KEY_MOD_RALT,           KEY_9,              // ³
+    0xB6, 0x00, KEY_MOD_RALT,           KEY_P,              // ¶
+    0xB8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ¸
+    0xBB, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          // »
+    0xBC, 0x00, KEY_MOD_RALT,           KEY_0,              // ¼
+    0xBD, 0x00, KEY_MOD_RALT,           KEY_MINUS,          // ½
+    0xBE, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ¾
+    0xC9, 0x00, KEY_MOD_LSHIFT,         KEY_SLASH,          // É
+    0xE9, 0x00, KEY_NONE,               KEY_SLASH           // é
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ca_fr_win[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // `
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC8, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xCA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCC, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xD2, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDD, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // â
+    0xE8, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ê
+    0xEC, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // î
+    0xF2, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFD, 0x00, KEY_MOD_RALT,           KEY_SLASH,          KEY_NONE,               KEY_Y               // ý
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR)
+inline constexpr hid_locale_t locale_ca_fr_win {
+    ascii_ca_fr_win, sizeof(ascii_ca_fr_win) / 3,
+    utf8_ca_fr_win, sizeof(utf8_ca_fr_win) / 4,
+    combinations_ca_fr_win, sizeof(combinations_ca_fr_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE) || defined(LOCALE_CH_FR)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ch_de_win[] = {
+    0x21, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // !
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_RALT,           KEY_3,              // #
+    0x24, KEY_NONE,               KEY_BACKSLASH,      // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_3,              // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_1,              // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_RALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_MOD_RALT,           KEY_102ND,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_RALT,           KEY_APOSTROPHE,     // {
+    0x7C, KEY_MOD_RALT,           KEY_7,              // |
+    0x7D, KEY_MOD_RALT,           KEY_BACKSLASH,      // }
+    0x7E, KEY_MOD_RALT,           KEY_EQUAL           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ch_de_win[] = {
+    0xA2, 0x00, KEY_MOD_RALT,           KEY_8,              // ¢
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // £
+    0xA6, 0x00, KEY_MOD_RALT,           KEY_1,              // ¦
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_6,              // ¬
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // à
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xE7, 0x00, KEY_MOD_LSHIFT,         KEY_4,              // ç
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // è
+    0xE9, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // é
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xFC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ü
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ch_de_win[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD6, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // â
+    0xEA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE)
+inline constexpr hid_locale_t locale_ch_de_win {
+    ascii_ch_de_win, sizeof(ascii_ch_de_win) / 3,
+    utf8_ch_de_win, sizeof(utf8_ch_de_win) / 4,
+    combinations_ch_de_win, sizeof(combinations_ch_de_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_FR)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ch_fr_win[] = {
+    0xA2, 0x00, KEY_MOD_RALT,           KEY_8,              // ¢
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // £
+    0xA6, 0x00, KEY_MOD_RALT,           KEY_1,              // ¦
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_6,              // ¬
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xE0, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // à
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // ä
+    0xE7, 0x00, KEY_MOD_LSHIFT,         KEY_4,              // ç
+    0xE8, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // è
+    0xE9, 0x00, KEY_NONE,               KEY_SEMICOLON,      // é
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // ö
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // ü
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_FR)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ch_fr_win[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD6, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // â
+    0xEA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_FR)
+inline constexpr hid_locale_t locale_ch_fr_win {
+    ascii_ch_de_win, sizeof(ascii_ch_de_win) / 3,
+    utf8_ch_fr_win, sizeof(utf8_ch_fr_win) / 4,
+    combinations_ch_fr_win, sizeof(combinations_ch_fr_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_cz_win[] = {
+    0x21, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // !
+    0x22, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // "
+    0x23, KEY_MOD_RALT,           KEY_X,              // #
+    0x24, KEY_MOD_RALT,           KEY_SEMICOLON,      // $
+    0x25, KEY_MOD_LSHIFT,         KEY_MINUS,          // %
+    0x26, KEY_MOD_RALT,           KEY_C,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // (
+    0x29, KEY_NONE,               KEY_RIGHTBRACE,     // )
+    0x2A, KEY_MOD_RALT,           KEY_SLASH,          // *
+    0x2B, KEY_NONE,               KEY_1,              // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // /
+    0x30, KEY_MOD_LSHIFT,         KEY_0,              // 0
+    0x31, KEY_MOD_LSHIFT,         KEY_1,              // 1
+    0x32, KEY_MOD_LSHIFT,         KEY_2,              // 2
+    0x33, KEY_MOD_LSHIFT,         KEY_3,              // 3
+    0x34, KEY_MOD_LSHIFT,         KEY_4,              // 4
+    0x35, KEY_MOD_LSHIFT,         KEY_5,              // 5
+    0x36, KEY_MOD_LSHIFT,         KEY_6,              // 6
+    0x37, KEY_MOD_LSHIFT,         KEY_7,              // 7
+    0x38, KEY_MOD_LSHIFT,         KEY_8,              // 8
+    0x39, KEY_MOD_LSHIFT,         KEY_9,              // 9
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_GRAVE,          // ;
+    0x3C, KEY_MOD_RALT,           KEY_COMMA,          // <
+    0x3D, KEY_NONE,               KEY_MINUS,          // =
+    0x3E, KEY_MOD_RALT,           KEY_DOT,            // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_COMMA,          // ?
+    0x40, KEY_MOD_RALT,           KEY_V,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_RALT,           KEY_F,              // [
+    0x5C, KEY_NONE,               KEY_102ND,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_G,              // ]
+    0x5E, KEY_MOD_RALT,           KEY_3,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_RALT,           KEY_7,              // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_RALT,           KEY_B,              // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_102ND,          // |
+    0x7D, KEY_MOD_RALT,           KEY_N,              // }
+    0x7E, KEY_MOD_RALT,           KEY_1               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_cz_win[] = {
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // ¤
+    0xA7, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // §
+    0xA8, 0x00, KEY_NONE,               KEY_BACKSLASH,      // ¨
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_5,              // °
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_9,              // ´
+    0xB8, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ¸
+    0xD7, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ×
+    0xDF, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     // ß
+    0xE1, 0x00, KEY_NONE,               KEY_8,              // á
+    0xE9, 0x00, KEY_NONE,               KEY_0,              // é
+    0xED, 0x00, KEY_NONE,               KEY_9,              // í
+    0xF7, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      // ÷
+    0xFA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ú
+    0xFD, 0x00, KEY_NONE,               KEY_7,              // ý
+    0x0D, 0x01, KEY_NONE,               KEY_4,              // č
+    0x10, 0x01, KEY_MOD_RALT,           KEY_D,              // Đ
+    0x11, 0x01, KEY_MOD_RALT,           KEY_S,              // đ
+    0x1B, 0x01, KEY_NONE,               KEY_2,              // ě
+    0x41, 0x01, KEY_MOD_RALT,           KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_RALT,           KEY_K,              // ł
+    0x59, 0x01, KEY_NONE,               KEY_5,              // ř
+    0x61, 0x01, KEY_NONE,               KEY_3,              // š
+    0x6F, 0x01, KEY_NONE,               KEY_SEMICOLON,      // ů
+    0x7E, 0x01, KEY_NONE,               KEY_6,              // ž
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_cz_win[] = {
+    0xB7, 0x00, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_SPACE,          // ·
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC4, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC5, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // Å
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCB, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCF, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD6, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDC, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Z,              // Ý
+    0xE4, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // ä
+    0xE5, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_A,              // å
+    0xEB, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_E,              // ë
+    0xEF, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ï
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF6, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ö
+    0xFC, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ü
+    0xFF, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_Z,              // ÿ
+    0x02, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_A,              // Ă
+    0x03, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_A,              // ă
+    0x04, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_A,              // ą
+    0x06, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_C,              // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0E, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_D,              // ď
+    0x16, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_E,              // Ė
+    0x17, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_E,              // ė
+    0x18, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_E,              // ę
+    0x1A, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1E, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_G,              // Ğ
+    0x1F, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_G,              // ğ
+    0x2E, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_I,              // Į
+    0x2F, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_I,              // į
+    0x30, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_I,              // İ
+    0x31, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_I,              // ı
+    0x39, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ĺ
+    0x3A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_L,              // ĺ
+    0x3D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ľ
+    0x3E, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_L,              // ľ
+    0x43, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_N,              // ń
+    0x47, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_N,              // ň
+    0x50, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_O,              // ő
+    0x54, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ŕ
+    0x55, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_R,              // ŕ
+    0x58, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x5A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_S,              // ś
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Š
+    0x64, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x65, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_T,              // ť
+    0x6E, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Ů
+    0x70, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_U,              // ű
+    0x72, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_U,              // Ų
+    0x73, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_U,              // ų
+    0x78, 0x01, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_Z,              // Ÿ
+    0x79, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ź
+    0x7A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ź
+    0x7B, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_Y,              // Ż
+    0x7C, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_Y,              // ż
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ž
+    0xC7, 0x02, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ˇ
+    0xD8, 0x02, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ˘
+    0xDB, 0x02, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_SPACE,          // ˛
+    0xDD, 0x02, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_SPACE           // ˝
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ)
+inline constexpr hid_locale_t locale_cz_win {
+    ascii_cz_win, sizeof(ascii_cz_win) / 3,
+    utf8_cz_win, sizeof(utf8_cz_win) / 4,
+    combinations_cz_win, sizeof(combinations_cz_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DE)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_de_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_NONE,               KEY_BACKSLASH,      // #
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_NONE,               KEY_RIGHTBRACE,     // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_Q,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_RALT,           KEY_8,              // [
+    0x5C, KEY_MOD_RALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_9,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_MOD_RALT,           KEY_102ND,          // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_MOD_RALT,           KEY_RIGHTBRACE      // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DE)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_de_win[] = {
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // §
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xB2, 0x00, KEY_MOD_RALT,           KEY_2,              // ²
+    0xB3, 0x00, KEY_MOD_RALT,           KEY_3,              // ³
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ä
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ö
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ü
+    0xDF, 0x00, KEY_NONE,               KEY_MINUS,          // ß
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xFC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ü
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DE)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_de_win[] = {
+    0x5E, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0xB4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Z,              // Ý
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_A,              // â
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_E,              // ê
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_I,              // î
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_U,              // û
+    0xFD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Z               // ý
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DE)
+inline constexpr hid_locale_t locale_de_win {
+    ascii_de_win, sizeof(ascii_de_win) / 3,
+    utf8_de_win, sizeof(utf8_de_win) / 4,
+    combinations_de_win, sizeof(combinations_de_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DK)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_dk_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x24, KEY_MOD_RALT,           KEY_4,              // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_MINUS,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x5B, KEY_MOD_RALT,           KEY_8,              // [
+    0x5C, KEY_MOD_RALT,           KEY_102ND,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_9,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_MOD_RALT,           KEY_EQUAL,          // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DK)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_dk_win[] = {
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_3,              // £
+    0xA4, 0x00, KEY_MOD_LSHIFT,         KEY_4,              // ¤
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // §
+    0xBD, 0x00, KEY_NONE,               KEY_GRAVE,          // ½
+    0xC5, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Å
+    0xC6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Æ
+    0xD8, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ø
+    0xE5, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // å
+    0xE6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // æ
+    0xF8, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ø
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DK)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_dk_win[] = {
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD6, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // â
+    0xE4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ô
+    0xF6, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_DK)
+inline constexpr hid_locale_t locale_dk_win {
+    ascii_dk_win, sizeof(ascii_dk_win) / 3,
+    utf8_dk_win, sizeof(utf8_dk_win) / 4,
+    combinations_dk_win, sizeof(combinations_dk_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_EE)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ee_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x24, KEY_MOD_RALT,           KEY_4,              // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_MINUS,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x5B, KEY_MOD_RALT,           KEY_8,              // [
+    0x5C, KEY_MOD_RALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_9,              // ]
+    0x5E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_MOD_RALT,           KEY_102ND,          // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_EE)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ee_win[] = {
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_3,              // £
+    0xA4, 0x00, KEY_MOD_LSHIFT,         KEY_4,              // ¤
+    0xA7, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // §
+    0xBD, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // ½
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ä
+    0xD5, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ö
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ü
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xF5, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // õ
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xFC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ü
+    0x60, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_S,              // Š
+    0x61, 0x01, KEY_MOD_RALT,           KEY_S,              // š
+    0x7D, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_Z,              // Ž
+    0x7E, 0x01, KEY_MOD_RALT,           KEY_Z,              // ž
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_EE)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ee_win[] = {
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_SPACE,          // ~
+    0xB4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC2, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCE, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDB, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE2, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // â
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ê
+    0xEE, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // î
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFB, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // û
+    0x06, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_C,              // ć
+    0x0C, 0x01, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0D, 0x01, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_C,              // č
+    0x1C, 0x01, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_G,              // Ĝ
+    0x1D, 0x01, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_G,              // ĝ
+    0x43, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_N,              // ń
+    0x5A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_S,              // ś
+    0x79, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Z,              // Ź
+    0x7A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Z,              // ź
+    0xC7, 0x02, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_SPACE           // ˇ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_EE)
+inline constexpr hid_locale_t locale_ee_win {
+    ascii_ee_win, sizeof(ascii_ee_win) / 3,
+    utf8_ee_win, sizeof(utf8_ee_win) / 4,
+    combinations_ee_win, sizeof(combinations_ee_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_es_la_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_NONE,               KEY_RIGHTBRACE,     // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_Q,              // @
+    0x5B, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // [
+    0x5C, KEY_MOD_RALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_RALT,           KEY_BACKSLASH,      // `
+    0x7B, KEY_NONE,               KEY_APOSTROPHE,     // {
+    0x7C, KEY_NONE,               KEY_GRAVE,          // |
+    0x7D, KEY_NONE,               KEY_BACKSLASH,      // }
+    0x7E, KEY_MOD_RALT,           KEY_RIGHTBRACE      // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_es_la_win[] = {
+    0xA1, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          // ¡
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_GRAVE,          // ¬
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // °
+    0xBF, 0x00, KEY_NONE,               KEY_EQUAL,          // ¿
+    0xD1, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ñ
+    0xF1, 0x00, KEY_NONE,               KEY_SEMICOLON       // ñ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_es_la_win[] = {
+    0x5E, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ^
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // â
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ô
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA)
+inline constexpr hid_locale_t locale_es_la_win {
+    ascii_es_la_win, sizeof(ascii_es_la_win) / 3,
+    utf8_es_la_win, sizeof(utf8_es_la_win) / 4,
+    combinations_es_la_win, sizeof(combinations_es_la_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_es_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_RALT,           KEY_3,              // #
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_NONE,               KEY_RIGHTBRACE,     // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x5B, KEY_MOD_RALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_MOD_RALT,           KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_RALT,           KEY_APOSTROPHE,     // {
+    0x7C, KEY_MOD_RALT,           KEY_1,              // |
+    0x7D, KEY_MOD_RALT,           KEY_BACKSLASH,      // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_es_win[] = {
+    0xA1, 0x00, KEY_NONE,               KEY_EQUAL,          // ¡
+    0xAA, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ª
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_6,              // ¬
+    0xB7, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // ·
+    0xBA, 0x00, KEY_NONE,               KEY_GRAVE,          // º
+    0xBF, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          // ¿
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ç
+    0xD1, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ñ
+    0xE7, 0x00, KEY_NONE,               KEY_BACKSLASH,      // ç
+    0xF1, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ñ
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_es_win[] = {
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_RALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_RALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_ES)
+inline constexpr hid_locale_t locale_es_win {
+    ascii_es_win, sizeof(ascii_es_win) / 3,
+    utf8_es_win, sizeof(utf8_es_win) / 4,
+    combinations_es_win, sizeof(combinations_es_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FI) || defined(LOCALE_SE)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_fi_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x24, KEY_MOD_RALT,           KEY_4,              // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_MINUS,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x5B, KEY_MOD_RALT,           KEY_8,              // [
+    0x5C, KEY_MOD_RALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_9,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_MOD_RALT,           KEY_102ND,          // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FI) || defined(LOCALE_SE)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_fi_win[] = {
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_3,              // £
+    0xA4, 0x00, KEY_MOD_LSHIFT,         KEY_4,              // ¤
+    0xA7, 0x00, KEY_NONE,               KEY_GRAVE,          // §
+    0xBD, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ½
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ä
+    0xC5, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Å
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ö
+    0xE4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ä
+    0xE5, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // å
+    0xF6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ö
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FI) || defined(LOCALE_SE)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_fi_win[] = {
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD1, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // ã
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // õ
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FI)
+inline constexpr hid_locale_t locale_fi_win {
+    ascii_fi_win, sizeof(ascii_fi_win) / 3,
+    utf8_fi_win, sizeof(utf8_fi_win) / 4,
+    combinations_fi_win, sizeof(combinations_fi_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FR)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_fr_win[] = {
+    0x21, KEY_NONE,               KEY_SLASH,          // !
+    0x22, KEY_NONE,               KEY_3,              // "
+    0x23, KEY_MOD_RALT,           KEY_3,              // #
+    0x24, KEY_NONE,               KEY_RIGHTBRACE,     // $
+    0x25, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // %
+    0x26, KEY_NONE,               KEY_1,              // &
+    0x27, KEY_NONE,               KEY_4,              // '
+    0x28, KEY_NONE,               KEY_5,              // (
+    0x29, KEY_NONE,               KEY_MINUS,          // )
+    0x2A, KEY_NONE,               KEY_BACKSLASH,      // *
+    0x2C, KEY_NONE,               KEY_M,              // ,
+    0x2D, KEY_NONE,               KEY_6,              // -
+    0x2E, KEY_MOD_LSHIFT,         KEY_COMMA,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_DOT,            // /
+    0x30, KEY_MOD_LSHIFT,         KEY_0,              // 0
+    0x31, KEY_MOD_LSHIFT,         KEY_1,              // 1
+    0x32, KEY_MOD_LSHIFT,         KEY_2,              // 2
+    0x33, KEY_MOD_LSHIFT,         KEY_3,              // 3
+    0x34, KEY_MOD_LSHIFT,         KEY_4,              // 4
+    0x35, KEY_MOD_LSHIFT,         KEY_5,              // 5
+    0x36, KEY_MOD_LSHIFT,         KEY_6,              // 6
+    0x37, KEY_MOD_LSHIFT,         KEY_7,              // 7
+    0x38, KEY_MOD_LSHIFT,         KEY_8,              // 8
+    0x39, KEY_MOD_LSHIFT,         KEY_9,              // 9
+    0x3A, KEY_NONE,               KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_M,              // ?
+    0x40, KEY_MOD_RALT,           KEY_0,              // @
+    0x41, KEY_MOD_LSHIFT,         KEY_Q,              // A
+    0x4D, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // M
+    0x51, KEY_MOD_LSHIFT,         KEY_A,              // Q
+    0x57, KEY_MOD_LSHIFT,         KEY_Z,              // W
+    0x5A, KEY_MOD_LSHIFT,         KEY_W,              // Z
+    0x5B, KEY_MOD_RALT,           KEY_5,              // [
+    0x5C, KEY_MOD_RALT,           KEY_8,              // bslash
+    0x5D, KEY_MOD_RALT,           KEY_MINUS,          // ]
+    0x5E, KEY_MOD_RALT,           KEY_9,              // ^
+    0x5F, KEY_NONE,               KEY_8,              // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x61, KEY_NONE,               KEY_Q,              // a
+    0x6D, KEY_NONE,               KEY_SEMICOLON,      // m
+    0x71, KEY_NONE,               KEY_A,              // q
+    0x77, KEY_NONE,               KEY_Z,              // w
+    0x7A, KEY_NONE,               KEY_W,              // z
+    0x7B, KEY_MOD_RALT,           KEY_4,              // {
+    0x7C, KEY_MOD_RALT,           KEY_6,              // |
+    0x7D, KEY_MOD_RALT,           KEY_EQUAL,          // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FR)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_fr_win[] = {
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // £
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ¤
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_SLASH,          // §
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_MINUS,          // °
+    0xB2, 0x00, KEY_NONE,               KEY_GRAVE,          // ²
+    0xB5, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // µ
+    0xE0, 0x00, KEY_NONE,               KEY_0,              // à
+    0xE7, 0x00, KEY_NONE,               KEY_9,              // ç
+    0xE8, 0x00, KEY_NONE,               KEY_7,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_2,              // é
+    0xF9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // ù
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FR)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_fr_win[] = {
+    0x60, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xC0, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_Q,              // À
+    0xC2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Q,              // Â
+    0xC3, 0x00, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_Q,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Q,              // Ä
+    0xC8, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xCA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD1, 0x00, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE2, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_Q,              // â
+    0xE3, 0x00, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_Q,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_Q,              // ä
+    0xEA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_NONE,               KEY_I,              // ì
+    0xEE, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_NONE,               KEY_O,              // ò
+    0xF4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xFB, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U               // ü
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_FR)
+inline constexpr hid_locale_t locale_fr_win {
+    ascii_fr_win, sizeof(ascii_fr_win) / 3,
+    utf8_fr_win, sizeof(utf8_fr_win) / 4,
+    combinations_fr_win, sizeof(combinations_fr_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GB)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_gb_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_NONE,               KEY_BACKSLASH,      // #
+    0x40, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // @
+    0x5C, KEY_NONE,               KEY_102ND,          // bslash
+    0x7C, KEY_MOD_LSHIFT,         KEY_102ND,          // |
+    0x7E, KEY_MOD_LSHIFT,         KEY_BACKSLASH       // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GB) || defined(LOCALE_IE)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_gb_win[] = {
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // £
+    0xA6, 0x00, KEY_MOD_RALT,           KEY_GRAVE,          // ¦
+    0xAC, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ¬
+    0xC1, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_A,              // Á
+    0xC9, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_E,              // É
+    0xCD, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_I,              // Í
+    0xD3, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_O,              // Ó
+    0xDA, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_U,              // Ú
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_A,              // á
+    0xE9, 0x00, KEY_MOD_RALT,           KEY_E,              // é
+    0xED, 0x00, KEY_MOD_RALT,           KEY_I,              // í
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_O,              // ó
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_U,              // ú
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_4               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GB)
+inline constexpr hid_locale_t locale_gb_win {
+    ascii_gb_win, sizeof(ascii_gb_win) / 3,
+    utf8_gb_win, sizeof(utf8_gb_win) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GR)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_gr_win[] = {
+    0x3A, KEY_MOD_LSHIFT,         KEY_Q,              // :
+    0x3B, KEY_NONE,               KEY_Q,              // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x41, KEY_NONE,               KEY_NONE,           // A
+    0x42, KEY_NONE,               KEY_NONE,           // B
+    0x43, KEY_NONE,               KEY_NONE,           // C
+    0x44, KEY_NONE,               KEY_NONE,           // D
+    0x45, KEY_NONE,               KEY_NONE,           // E
+    0x46, KEY_NONE,               KEY_NONE,           // F
+    0x47, KEY_NONE,               KEY_NONE,           // G
+    0x48, KEY_NONE,               KEY_NONE,           // H
+    0x49, KEY_NONE,               KEY_NONE,           // I
+    0x4A, KEY_NONE,               KEY_NONE,           // J
+    0x4B, KEY_NONE,               KEY_NONE,           // K
+    0x4C, KEY_NONE,               KEY_NONE,           // L
+    0x4D, KEY_NONE,               KEY_NONE,           // M
+    0x4E, KEY_NONE,               KEY_NONE,           // N
+    0x4F, KEY_NONE,               KEY_NONE,           // O
+    0x50, KEY_NONE,               KEY_NONE,           // P
+    0x51, KEY_NONE,               KEY_NONE,           // Q
+    0x52, KEY_NONE,               KEY_NONE,           // R
+    0x53, KEY_NONE,               KEY_NONE,           // S
+    0x54, KEY_NONE,               KEY_NONE,           // T
+    0x55, KEY_NONE,               KEY_NONE,           // U
+    0x56, KEY_NONE,               KEY_NONE,           // V
+    0x57, KEY_NONE,               KEY_NONE,           // W
+    0x58, KEY_NONE,               KEY_NONE,           // X
+    0x59, KEY_NONE,               KEY_NONE,           // Y
+    0x5A, KEY_NONE,               KEY_NONE,           // Z
+    0x61, KEY_NONE,               KEY_NONE,           // a
+    0x62, KEY_NONE,               KEY_NONE,           // b
+    0x63, KEY_NONE,               KEY_NONE,           // c
+    0x64, KEY_NONE,               KEY_NONE,           // d
+    0x65, KEY_NONE,               KEY_NONE,           // e
+    0x66, KEY_NONE,               KEY_NONE,           // f
+    0x67, KEY_NONE,               KEY_NONE,           // g
+    0x68, KEY_NONE,               KEY_NONE,           // h
+    0x69, KEY_NONE,               KEY_NONE,           // i
+    0x6A, KEY_NONE,               KEY_NONE,           // j
+    0x6B, KEY_NONE,               KEY_NONE,           // k
+    0x6C, KEY_NONE,               KEY_NONE,           // l
+    0x6D, KEY_NONE,               KEY_NONE,           // m
+    0x6E, KEY_NONE,               KEY_NONE,           // n
+    0x6F, KEY_NONE,               KEY_NONE,           // o
+    0x70, KEY_NONE,               KEY_NONE,           // p
+    0x71, KEY_NONE,               KEY_NONE,           // q
+    0x72, KEY_NONE,               KEY_NONE,           // r
+    0x73, KEY_NONE,               KEY_NONE,           // s
+    0x74, KEY_NONE,               KEY_NONE,           // t
+    0x75, KEY_NONE,               KEY_NONE,           // u
+    0x76, KEY_NONE,               KEY_NONE,           // v
+    0x77, KEY_NONE,               KEY_NONE,           // w
+    0x78, KEY_NONE,               KEY_NONE,           // x
+    0x79, KEY_NONE,               KEY_NONE,           // y
+    0x7A, KEY_NONE,               KEY_NONE            // z
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GR)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_gr_win[] = {
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_4,              // £
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_8,              // ¤
+    0xA5, 0x00, KEY_MOD_RALT,           KEY_Y,              // ¥
+    0xA6, 0x00, KEY_MOD_RALT,           KEY_9,              // ¦
+    0xA7, 0x00, KEY_MOD_RALT,           KEY_5,              // §
+    0xA9, 0x00, KEY_MOD_RALT,           KEY_C,              // ©
+    0xAB, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      // «
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // ¬
+    0xAE, 0x00, KEY_MOD_RALT,           KEY_R,              // ®
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_0,              // °
+    0xB1, 0x00, KEY_MOD_RALT,           KEY_MINUS,          // ±
+    0xB2, 0x00, KEY_MOD_RALT,           KEY_2,              // ²
+    0xB3, 0x00, KEY_MOD_RALT,           KEY_3,              // ³
+    0xB6, 0x00, KEY_MOD_RALT,           KEY_6,              // ¶
+    0xBB, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // »
+    0xBD, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ½
+    0x91, 0x03, KEY_MOD_LSHIFT,         KEY_A,              // Α
+    0x92, 0x03, KEY_MOD_LSHIFT,         KEY_B,              // Β
+    0x93, 0x03, KEY_MOD_LSHIFT,         KEY_G,              // Γ
+    0x94, 0x03, KEY_MOD_LSHIFT,         KEY_D,              // Δ
+    0x95, 0x03, KEY_MOD_LSHIFT,         KEY_E,              // Ε
+    0x96, 0x03, KEY_MOD_LSHIFT,         KEY_Z,              // Ζ
+    0x97, 0x03, KEY_MOD_LSHIFT,         KEY_H,              // Η
+    0x98, 0x03, KEY_MOD_LSHIFT,         KEY_U,              // Θ
+    0x99, 0x03, KEY_MOD_LSHIFT,         KEY_I,              // Ι
+    0x9A, 0x03, KEY_MOD_LSHIFT,         KEY_K,              // Κ
+    0x9B, 0x03, KEY_MOD_LSHIFT,         KEY_L,              // Λ
+    0x9C, 0x03, KEY_MOD_LSHIFT,         KEY_M,              // Μ
+    0x9D, 0x03, KEY_MOD_LSHIFT,         KEY_N,              // Ν
+    0x9E, 0x03, KEY_MOD_LSHIFT,         KEY_J,              // Ξ
+    0x9F, 0x03, KEY_MOD_LSHIFT,         KEY_O,              // Ο
+    0xA0, 0x03, KEY_MOD_LSHIFT,         KEY_P,              // Π
+    0xA1, 0x03, KEY_MOD_LSHIFT,         KEY_R,              // Ρ
+    0xA3, 0x03, KEY_MOD_LSHIFT,         KEY_S,              // Σ
+    0xA4, 0x03, KEY_MOD_LSHIFT,         KEY_T,              // Τ
+    0xA5, 0x03, KEY_MOD_LSHIFT,         KEY_Y,              // Υ
+    0xA6, 0x03, KEY_MOD_LSHIFT,         KEY_F,              // Φ
+    0xA7, 0x03, KEY_MOD_LSHIFT,         KEY_X,              // Χ
+    0xA8, 0x03, KEY_MOD_LSHIFT,         KEY_C,              // Ψ
+    0xA9, 0x03, KEY_MOD_LSHIFT,         KEY_V,              // Ω
+    0xB1, 0x03, KEY_NONE,               KEY_A,              // α
+    0xB2, 0x03, KEY_NONE,               KEY_B,              // β
+    0xB3, 0x03, KEY_NONE,               KEY_G,              // γ
+    0xB4, 0x03, KEY_NONE,               KEY_D,              // δ
+    0xB5, 0x03, KEY_NONE,               KEY_E,              // ε
+    0xB6, 0x03, KEY_NONE,               KEY_Z,              // ζ
+    0xB7, 0x03, KEY_NONE,               KEY_H,              // η
+    0xB8, 0x03, KEY_NONE,               KEY_U,              // θ
+    0xB9, 0x03, KEY_NONE,               KEY_I,              // ι
+    0xBA, 0x03, KEY_NONE,               KEY_K,              // κ
+    0xBB, 0x03, KEY_NONE,               KEY_L,              // λ
+    0xBC, 0x03, KEY_NONE,               KEY_M,              // μ
+    0xBD, 0x03, KEY_NONE,               KEY_N,              // ν
+    0xBE, 0x03, KEY_NONE,               KEY_J,              // ξ
+    0xBF, 0x03, KEY_NONE,               KEY_O,              // ο
+    0xC0, 0x03, KEY_NONE,               KEY_P,              // π
+    0xC1, 0x03, KEY_NONE,               KEY_R,              // ρ
+    0xC2, 0x03, KEY_NONE,               KEY_W,              // ς
+    0xC3, 0x03, KEY_NONE,               KEY_S,              // σ
+    0xC4, 0x03, KEY_NONE,               KEY_T,              // τ
+    0xC5, 0x03, KEY_NONE,               KEY_Y,              // υ
+    0xC6, 0x03, KEY_NONE,               KEY_F,              // φ
+    0xC7, 0x03, KEY_NONE,               KEY_X,              // χ
+    0xC8, 0x03, KEY_NONE,               KEY_C,              // ψ
+    0xC9, 0x03, KEY_NONE,               KEY_V,              // ω
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GR)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_gr_win[] = {
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE,          // ¨
+    0x84, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE,          // ΄
+    0x85, 0x03, KEY_MOD_LSHIFT,         KEY_W,              KEY_NONE,               KEY_SPACE,          // ΅
+    0x86, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_A,              // Ά
+    0x88, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_E,              // Έ
+    0x89, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_H,              // Ή
+    0x8A, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_I,              // Ί
+    0x8C, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_O,              // Ό
+    0x8E, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_Y,              // Ύ
+    0x8F, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_V,              // Ώ
+    0x90, 0x03, KEY_MOD_LSHIFT,         KEY_W,              KEY_NONE,               KEY_I,              // ΐ
+    0xAA, 0x03, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_I,              // Ϊ
+    0xAB, 0x03, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_Y,              // Ϋ
+    0xAC, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_A,              // ά
+    0xAD, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_E,              // έ
+    0xAE, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_H,              // ή
+    0xAF, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_I,              // ί
+    0xB0, 0x03, KEY_MOD_LSHIFT,         KEY_W,              KEY_NONE,               KEY_Y,              // ΰ
+    0xCA, 0x03, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_NONE,               KEY_I,              // ϊ
+    0xCB, 0x03, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      KEY_NONE,               KEY_Y,              // ϋ
+    0xCC, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_O,              // ό
+    0xCD, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_Y,              // ύ
+    0xCE, 0x03, KEY_NONE,               KEY_SEMICOLON,      KEY_NONE,               KEY_V               // ώ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_GR)
+inline constexpr hid_locale_t locale_gr_win {
+    ascii_gr_win, sizeof(ascii_gr_win) / 3,
+    utf8_gr_win, sizeof(utf8_gr_win) / 4,
+    combinations_gr_win, sizeof(combinations_gr_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HR) || defined(LOCALE_SI)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_hr_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_EQUAL,          // *
+    0x2B, KEY_NONE,               KEY_EQUAL,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_V,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_RALT,           KEY_F,              // [
+    0x5C, KEY_MOD_RALT,           KEY_Q,              // bslash
+    0x5D, KEY_MOD_RALT,           KEY_G,              // ]
+    0x5E, KEY_MOD_RALT,           KEY_3,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_RALT,           KEY_7,              // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_RALT,           KEY_B,              // {
+    0x7C, KEY_MOD_RALT,           KEY_W,              // |
+    0x7D, KEY_MOD_RALT,           KEY_N,              // }
+    0x7E, KEY_MOD_RALT,           KEY_1               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HR)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_hr_win[] = {
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // ¤
+    0xA7, 0x00, KEY_MOD_RALT,           KEY_M,              // §
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_5,              // °
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_9,              // ´
+    0xB8, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ¸
+    0xD7, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ×
+    0xDF, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     // ß
+    0xF7, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      // ÷
+    0x06, 0x01, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ć
+    0x07, 0x01, KEY_NONE,               KEY_APOSTROPHE,     // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Č
+    0x0D, 0x01, KEY_NONE,               KEY_SEMICOLON,      // č
+    0x10, 0x01, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Đ
+    0x11, 0x01, KEY_NONE,               KEY_RIGHTBRACE,     // đ
+    0x41, 0x01, KEY_MOD_RALT,           KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_RALT,           KEY_K,              // ł
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Š
+    0x61, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // š
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ž
+    0x7E, 0x01, KEY_NONE,               KEY_BACKSLASH,      // ž
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HR)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_hr_win[] = {
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_SPACE,          // ¨
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC7, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_C,              // Ç
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_A,              // ä
+    0xE7, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_C,              // ç
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_E,              // ë
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_O,              // ö
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_U,              // ü
+    0x02, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_A,              // Ă
+    0x03, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_A,              // ă
+    0x04, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_A,              // ą
+    0x0E, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_D,              // ď
+    0x18, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_E,              // ę
+    0x1A, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_E,              // ě
+    0x50, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_O,              // ő
+    0x5E, 0x01, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_S,              // Ş
+    0x5F, 0x01, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_S,              // ş
+    0x70, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_U,              // ű
+    0xC7, 0x02, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_SPACE,          // ˇ
+    0xD8, 0x02, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ˘
+    0xD9, 0x02, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_SPACE,          // ˙
+    0xDB, 0x02, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_SPACE,          // ˛
+    0xDD, 0x02, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_SPACE           // ˝
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HR)
+inline constexpr hid_locale_t locale_hr_win {
+    ascii_hr_win, sizeof(ascii_hr_win) / 3,
+    utf8_hr_win, sizeof(utf8_hr_win) / 4,
+    combinations_hr_win, sizeof(combinations_hr_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HU)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_hu_win[] = {
+    0x21, KEY_MOD_LSHIFT,         KEY_4,              // !
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_RALT,           KEY_X,              // #
+    0x24, KEY_MOD_RALT,           KEY_SEMICOLON,      // $
+    0x26, KEY_MOD_RALT,           KEY_C,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_1,              // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_RALT,           KEY_SLASH,          // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_3,              // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_6,              // /
+    0x30, KEY_NONE,               KEY_GRAVE,          // 0
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_RALT,           KEY_COMMA,          // ;
+    0x3C, KEY_MOD_RALT,           KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_7,              // =
+    0x3E, KEY_MOD_RALT,           KEY_Z,              // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_COMMA,          // ?
+    0x40, KEY_MOD_RALT,           KEY_V,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_RALT,           KEY_F,              // [
+    0x5C, KEY_MOD_RALT,           KEY_Q,              // bslash
+    0x5D, KEY_MOD_RALT,           KEY_G,              // ]
+    0x5E, KEY_MOD_RALT,           KEY_3,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_RALT,           KEY_7,              // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_RALT,           KEY_B,              // {
+    0x7C, KEY_MOD_RALT,           KEY_W,              // |
+    0x7D, KEY_MOD_RALT,           KEY_N,              // }
+    0x7E, KEY_MOD_RALT,           KEY_1               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HU)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_hu_win[] = {
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // ¤
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // §
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_5,              // °
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_9,              // ´
+    0xB8, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ¸
+    0xC1, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Á
+    0xC4, 0x00, KEY_MOD_RALT,           KEY_E,              // Ä
+    0xC9, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // É
+    0xCD, 0x00, KEY_MOD_LSHIFT,         KEY_102ND,          // Í
+    0xD3, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          // Ó
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_0,              // Ö
+    0xD7, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ×
+    0xDA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ú
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_MINUS,          // Ü
+    0xDF, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     // ß
+    0xE1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // á
+    0xE4, 0x00, KEY_MOD_RALT,           KEY_A,              // ä
+    0xE9, 0x00, KEY_NONE,               KEY_SEMICOLON,      // é
+    0xED, 0x00, KEY_NONE,               KEY_102ND,          // í
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          // ó
+    0xF6, 0x00, KEY_NONE,               KEY_0,              // ö
+    0xF7, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      // ÷
+    0xFA, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ú
+    0xFC, 0x00, KEY_NONE,               KEY_MINUS,          // ü
+    0x10, 0x01, KEY_MOD_RALT,           KEY_D,              // Đ
+    0x11, 0x01, KEY_MOD_RALT,           KEY_S,              // đ
+    0x41, 0x01, KEY_MOD_RALT,           KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_RALT,           KEY_K,              // ł
+    0x50, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ő
+    0x51, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // ő
+    0x70, 0x01, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ű
+    0x71, 0x01, KEY_NONE,               KEY_BACKSLASH,      // ű
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_U               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HU)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_hu_win[] = {
+    0xA8, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_SPACE,          // ¨
+    0xCB, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xEB, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_E,              // ë
+    0x02, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_A,              // Ă
+    0x03, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_A,              // ă
+    0x04, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_A,              // ą
+    0x0C, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0D, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_C,              // č
+    0x0E, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_D,              // ď
+    0x18, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_E,              // ę
+    0x1A, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_E,              // ě
+    0x47, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_N,              // ň
+    0x58, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x59, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_R,              // ř
+    0x60, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_S,              // Š
+    0x61, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_S,              // š
+    0x64, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x65, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_T,              // ť
+    0x7B, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_Y,              // Ż
+    0x7C, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_Y,              // ż
+    0x7D, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_Y,              // Ž
+    0x7E, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_Y,              // ž
+    0xC7, 0x02, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_SPACE,          // ˇ
+    0xD8, 0x02, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ˘
+    0xD9, 0x02, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_SPACE,          // ˙
+    0xDB, 0x02, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_SPACE,          // ˛
+    0xDD, 0x02, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_SPACE           // ˝
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_HU)
+inline constexpr hid_locale_t locale_hu_win {
+    ascii_hu_win, sizeof(ascii_hu_win) / 3,
+    utf8_hu_win, sizeof(utf8_hu_win) / 4,
+    combinations_hu_win, sizeof(combinations_hu_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IE)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ie_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_NONE,               KEY_BACKSLASH,      // #
+    0x40, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // @
+    0x5C, KEY_NONE,               KEY_102ND,          // bslash
+    0x60, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // `
+    0x7C, KEY_MOD_LSHIFT,         KEY_102ND,          // |
+    0x7E, KEY_MOD_LSHIFT,         KEY_BACKSLASH       // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IE)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ie_win[] = {
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC8, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xCC, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xD2, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD9, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDD, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_A,              // à
+    0xE8, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_E,              // è
+    0xEC, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_I,              // ì
+    0xF2, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_O,              // ò
+    0xF9, 0x00, KEY_NONE,               KEY_GRAVE,          KEY_NONE,               KEY_U,              // ù
+    0xFD, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_Y               // ý
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IE)
+inline constexpr hid_locale_t locale_ie_win {
+    ascii_ie_win, sizeof(ascii_ie_win) / 3,
+    utf8_gb_win, sizeof(utf8_gb_win) / 4,
+    combinations_ie_win, sizeof(combinations_ie_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IN) || defined(LOCALE_US)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_in_win[] = {
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IN)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_in_win[] = {
+    0xC6, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_Q,              // Æ
+    0xD1, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_Y,              // Ñ
+    0xE6, 0x00, KEY_MOD_RALT,           KEY_Q,              // æ
+    0xF1, 0x00, KEY_MOD_RALT,           KEY_Y,              // ñ
+    0x00, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_A,              // Ā
+    0x01, 0x01, KEY_MOD_RALT,           KEY_A,              // ā
+    0x12, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_E,              // Ē
+    0x13, 0x01, KEY_MOD_RALT,           KEY_E,              // ē
+    0x2A, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_I,              // Ī
+    0x2B, 0x01, KEY_MOD_RALT,           KEY_I,              // ī
+    0x4C, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_O,              // Ō
+    0x4D, 0x01, KEY_MOD_RALT,           KEY_O,              // ō
+    0x5A, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_S,              // Ś
+    0x5B, 0x01, KEY_MOD_RALT,           KEY_S,              // ś
+    0x6A, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_U,              // Ū
+    0x6B, 0x01, KEY_MOD_RALT,           KEY_U,              // ū
+    0x23, 0x03, KEY_MOD_RALT,           KEY_DOT,            // ̣
+    0x25, 0x03, KEY_MOD_RALT,           KEY_L,              // ̥
+    0x0C, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_D,              // Ḍ
+    0x0D, 0x1E, KEY_MOD_RALT,           KEY_D,              // ḍ
+    0x24, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_H,              // Ḥ
+    0x25, 0x1E, KEY_MOD_RALT,           KEY_H,              // ḥ
+    0x40, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_M,              // Ṁ
+    0x44, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_G,              // Ṅ
+    0x45, 0x1E, KEY_MOD_RALT,           KEY_G,              // ṅ
+    0x46, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_N,              // Ṇ
+    0x47, 0x1E, KEY_MOD_RALT,           KEY_N,              // ṇ
+    0x62, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_X,              // Ṣ
+    0x63, 0x1E, KEY_MOD_RALT,           KEY_X,              // ṣ
+    0x6C, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_T,              // Ṭ
+    0x6D, 0x1E, KEY_MOD_RALT,           KEY_T,              // ṭ
+    0xB9, 0x20, KEY_MOD_RALT,           KEY_4               // ₹
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IN)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_in_win[] = {
+    0xCA, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xD4, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_6,              KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xEA, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_6,              KEY_NONE,               KEY_E,              // ê
+    0xF4, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_6,              KEY_NONE,               KEY_O,              // ô
+    0x14, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_9,              KEY_MOD_LSHIFT,         KEY_E,              // Ĕ
+    0x15, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_9,              KEY_NONE,               KEY_E,              // ĕ
+    0x4E, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_9,              KEY_MOD_LSHIFT,         KEY_O,              // Ŏ
+    0x4F, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_9,              KEY_NONE,               KEY_O,              // ŏ
+    0x6C, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_9,              KEY_MOD_LSHIFT,         KEY_U,              // Ŭ
+    0x6D, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_9,              KEY_NONE,               KEY_U,              // ŭ
+    0x00, 0x03, KEY_MOD_RALT,           KEY_COMMA,          KEY_NONE,               KEY_GRAVE,          // ̀
+    0x01, 0x03, KEY_MOD_RALT,           KEY_COMMA,          KEY_NONE,               KEY_APOSTROPHE,     // ́
+    0x03, 0x03, KEY_MOD_RALT,           KEY_COMMA,          KEY_MOD_LSHIFT,         KEY_GRAVE,          // ̃
+    0x04, 0x03, KEY_MOD_RALT,           KEY_COMMA,          KEY_NONE,               KEY_MINUS,          // ̄
+    0x07, 0x03, KEY_MOD_RALT,           KEY_COMMA,          KEY_MOD_LSHIFT,         KEY_DOT,            // ̇
+    0x24, 0x03, KEY_MOD_RALT,           KEY_COMMA,          KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // ̤
+    0x31, 0x03, KEY_MOD_RALT,           KEY_COMMA,          KEY_MOD_LSHIFT,         KEY_MINUS,          // ̱
+    0x32, 0x03, KEY_MOD_RALT,           KEY_COMMA,          KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // ̲
+    0x0E, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_D,              // Ḏ
+    0x0F, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_D,              // ḏ
+    0x2A, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_9,              KEY_MOD_LSHIFT,         KEY_H,              // Ḫ
+    0x2B, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_9,              KEY_NONE,               KEY_H,              // ḫ
+    0x34, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_K,              // Ḵ
+    0x35, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_K,              // ḵ
+    0x3A, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_L,              // Ḻ
+    0x3B, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_L,              // ḻ
+    0x48, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_N,              // Ṉ
+    0x49, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_N,              // ṉ
+    0x5E, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_R,              // Ṟ
+    0x5F, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_R,              // ṟ
+    0x6E, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_T,              // Ṯ
+    0x6F, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_T,              // ṯ
+    0x96, 0x1E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          KEY_NONE,               KEY_H               // ẖ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IN)
+inline constexpr hid_locale_t locale_in_win {
+    ascii_in_win, sizeof(ascii_in_win) / 3,
+    utf8_in_win, sizeof(utf8_in_win) / 4,
+    combinations_in_win, sizeof(combinations_in_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IS)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_is_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_RIGHTBRACE,     // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_BACKSLASH,      // +
+    0x2D, KEY_NONE,               KEY_EQUAL,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // ?
+    0x40, KEY_MOD_RALT,           KEY_Q,              // @
+    0x5B, KEY_MOD_RALT,           KEY_8,              // [
+    0x5C, KEY_MOD_RALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_9,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_EQUAL,          // _
+    0x60, KEY_MOD_RALT,           KEY_BACKSLASH,      // `
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_MOD_RALT,           KEY_102ND,          // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_MOD_RALT,           KEY_RIGHTBRACE      // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IS)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_is_win[] = {
+    0xB0, 0x00, KEY_NONE,               KEY_GRAVE,          // °
+    0xC6, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Æ
+    0xD0, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ð
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_MINUS,          // Ö
+    0xDE, 0x00, KEY_MOD_LSHIFT,         KEY_SLASH,          // Þ
+    0xE6, 0x00, KEY_NONE,               KEY_SEMICOLON,      // æ
+    0xF0, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ð
+    0xF6, 0x00, KEY_NONE,               KEY_MINUS,          // ö
+    0xFE, 0x00, KEY_NONE,               KEY_SLASH,          // þ
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IS)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_is_win[] = {
+    0x5E, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ^
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // â
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IS)
+inline constexpr hid_locale_t locale_is_win {
+    ascii_is_win, sizeof(ascii_is_win) / 3,
+    utf8_is_win, sizeof(utf8_is_win) / 4,
+    combinations_is_win, sizeof(combinations_is_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IT)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_it_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_MOD_RALT,           KEY_APOSTROPHE,     // #
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // *
+    0x2B, KEY_NONE,               KEY_RIGHTBRACE,     // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_SEMICOLON,      // @
+    0x5B, KEY_MOD_RALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_NONE,               KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ]
+    0x5E, KEY_MOD_LSHIFT,         KEY_EQUAL,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_NONE,           // `
+    0x7B, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_GRAVE,          // |
+    0x7D, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // }
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IT)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_it_win[] = {
+    0xA3, 0x00, KEY_MOD_LSHIFT,         KEY_3,              // £
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // §
+    0xB0, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // °
+    0xE0, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // à
+    0xE7, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // ç
+    0xE8, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // è
+    0xE9, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // é
+    0xEC, 0x00, KEY_NONE,               KEY_EQUAL,          // ì
+    0xF2, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ò
+    0xF9, 0x00, KEY_NONE,               KEY_BACKSLASH,      // ù
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_IT)
+inline constexpr hid_locale_t locale_it_win {
+    ascii_it_win, sizeof(ascii_it_win) / 3,
+    utf8_it_win, sizeof(utf8_it_win) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LT)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_lt_win[] = {
+    0x21, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_1,              // !
+    0x23, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_3,              // #
+    0x24, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_4,              // $
+    0x25, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_5,              // %
+    0x26, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_7,              // &
+    0x2A, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_8,              // *
+    0x2B, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // +
+    0x31, KEY_MOD_RALT,           KEY_1,              // 1
+    0x32, KEY_MOD_RALT,           KEY_2,              // 2
+    0x33, KEY_MOD_RALT,           KEY_3,              // 3
+    0x34, KEY_MOD_RALT,           KEY_4,              // 4
+    0x35, KEY_MOD_RALT,           KEY_5,              // 5
+    0x36, KEY_MOD_RALT,           KEY_6,              // 6
+    0x37, KEY_MOD_RALT,           KEY_7,              // 7
+    0x38, KEY_MOD_RALT,           KEY_8,              // 8
+    0x3D, KEY_MOD_RALT,           KEY_EQUAL,          // =
+    0x40, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_2,              // @
+    0x5E, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_6               // ^
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LT)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_lt_win[] = {
+    0x04, 0x01, KEY_MOD_LSHIFT,         KEY_1,              // Ą
+    0x05, 0x01, KEY_NONE,               KEY_1,              // ą
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_2,              // Č
+    0x0D, 0x01, KEY_NONE,               KEY_2,              // č
+    0x16, 0x01, KEY_MOD_LSHIFT,         KEY_4,              // Ė
+    0x17, 0x01, KEY_NONE,               KEY_4,              // ė
+    0x18, 0x01, KEY_MOD_LSHIFT,         KEY_3,              // Ę
+    0x19, 0x01, KEY_NONE,               KEY_3,              // ę
+    0x2E, 0x01, KEY_MOD_LSHIFT,         KEY_5,              // Į
+    0x2F, 0x01, KEY_NONE,               KEY_5,              // į
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_6,              // Š
+    0x61, 0x01, KEY_NONE,               KEY_6,              // š
+    0x6A, 0x01, KEY_MOD_LSHIFT,         KEY_8,              // Ū
+    0x6B, 0x01, KEY_NONE,               KEY_8,              // ū
+    0x72, 0x01, KEY_MOD_LSHIFT,         KEY_7,              // Ų
+    0x73, 0x01, KEY_NONE,               KEY_7,              // ų
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          // Ž
+    0x7E, 0x01, KEY_NONE,               KEY_EQUAL,          // ž
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LT)
+inline constexpr hid_locale_t locale_lt_win {
+    ascii_lt_win, sizeof(ascii_lt_win) / 3,
+    utf8_lt_win, sizeof(utf8_lt_win) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LV)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_lv_win[] = {
+    0x22, KEY_NONE,               KEY_SPACE,          // "
+    0x27, KEY_NONE,               KEY_SPACE,          // '
+    0x60, KEY_NONE,               KEY_NONE            // `
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LV)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_lv_win[] = {
+    0xA0, 0x00, KEY_MOD_RALT,           KEY_1,
+    0xA7, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_4,              // §
+    0xAB, 0x00, KEY_MOD_RALT,           KEY_2,              // «
+    0xAD, 0x00, KEY_NONE,               KEY_GRAVE,          // ­
+    0xB0, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_5,              // °
+    0xB1, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_7,              // ±
+    0xBB, 0x00, KEY_MOD_RALT,           KEY_3,              // »
+    0xD7, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_8,              // ×
+    0x00, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_A,              // Ā
+    0x01, 0x01, KEY_MOD_RALT,           KEY_A,              // ā
+    0x0C, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_C,              // Č
+    0x0D, 0x01, KEY_MOD_RALT,           KEY_C,              // č
+    0x12, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_E,              // Ē
+    0x13, 0x01, KEY_MOD_RALT,           KEY_E,              // ē
+    0x22, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_G,              // Ģ
+    0x23, 0x01, KEY_MOD_RALT,           KEY_G,              // ģ
+    0x2A, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_I,              // Ī
+    0x2B, 0x01, KEY_MOD_RALT,           KEY_I,              // ī
+    0x36, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_K,              // Ķ
+    0x37, 0x01, KEY_MOD_RALT,           KEY_K,              // ķ
+    0x3B, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_L,              // Ļ
+    0x3C, 0x01, KEY_MOD_RALT,           KEY_L,              // ļ
+    0x45, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_N,              // Ņ
+    0x46, 0x01, KEY_MOD_RALT,           KEY_N,              // ņ
+    0x4C, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_O,              // Ō
+    0x4D, 0x01, KEY_MOD_RALT,           KEY_O,              // ō
+    0x56, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_R,              // Ŗ
+    0x57, 0x01, KEY_MOD_RALT,           KEY_R,              // ŗ
+    0x60, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_S,              // Š
+    0x61, 0x01, KEY_MOD_RALT,           KEY_S,              // š
+    0x6A, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_U,              // Ū
+    0x6B, 0x01, KEY_MOD_RALT,           KEY_U,              // ū
+    0x7D, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_Z,              // Ž
+    0x7E, 0x01, KEY_MOD_RALT,           KEY_Z,              // ž
+    0x13, 0x20, KEY_MOD_RALT,           KEY_MINUS,          // –
+    0x14, 0x20, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          // —
+    0x19, 0x20, KEY_MOD_RALT,           KEY_6,              // ’
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_4               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LV)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_lv_win[] = {
+    0x22, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // "
+    0x27, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // '
+    0xA8, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE           // ´
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_LV)
+inline constexpr hid_locale_t locale_lv_win {
+    ascii_lv_win, sizeof(ascii_lv_win) / 3,
+    utf8_lv_win, sizeof(utf8_lv_win) / 4,
+    combinations_lv_win, sizeof(combinations_lv_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NL)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_nl_win[] = {
+    0x22, KEY_NONE,               KEY_SPACE,          // "
+    0x27, KEY_NONE,               KEY_SPACE,          // '
+    0x5E, KEY_NONE,               KEY_SPACE           // ^
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NL)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_nl_win[] = {
+    0xA1, 0x00, KEY_MOD_RALT,           KEY_1,              // ¡
+    0xA2, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_C,              // ¢
+    0xA3, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_4,              // £
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_4,              // ¤
+    0xA5, 0x00, KEY_MOD_RALT,           KEY_MINUS,          // ¥
+    0xA6, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_BACKSLASH,      // ¦
+    0xA7, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_S,              // §
+    0xA8, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // ¨
+    0xA9, 0x00, KEY_MOD_RALT,           KEY_C,              // ©
+    0xAB, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      // «
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // ¬
+    0xAE, 0x00, KEY_MOD_RALT,           KEY_R,              // ®
+    0xB0, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_SEMICOLON,      // °
+    0xB2, 0x00, KEY_MOD_RALT,           KEY_2,              // ²
+    0xB3, 0x00, KEY_MOD_RALT,           KEY_3,              // ³
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     // ´
+    0xB6, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      // ¶
+    0xB9, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_1,              // ¹
+    0xBB, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // »
+    0xBC, 0x00, KEY_MOD_RALT,           KEY_6,              // ¼
+    0xBD, 0x00, KEY_MOD_RALT,           KEY_7,              // ½
+    0xBE, 0x00, KEY_MOD_RALT,           KEY_8,              // ¾
+    0xBF, 0x00, KEY_MOD_RALT,           KEY_SLASH,          // ¿
+    0xC1, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_A,              // Á
+    0xC4, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_Q,              // Ä
+    0xC5, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_W,              // Å
+    0xC6, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_Z,              // Æ
+    0xC7, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_COMMA,          // Ç
+    0xC9, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_E,              // É
+    0xCD, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_I,              // Í
+    0xD0, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_D,              // Ð
+    0xD1, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_N,              // Ñ
+    0xD3, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_O,              // Ó
+    0xD6, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_P,              // Ö
+    0xD7, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ×
+    0xD8, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_L,              // Ø
+    0xDA, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_U,              // Ú
+    0xDC, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_Y,              // Ü
+    0xDE, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_T,              // Þ
+    0xDF, 0x00, KEY_MOD_RALT,           KEY_S,              // ß
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_A,              // á
+    0xE4, 0x00, KEY_MOD_RALT,           KEY_Q,              // ä
+    0xE5, 0x00, KEY_MOD_RALT,           KEY_W,              // å
+    0xE6, 0x00, KEY_MOD_RALT,           KEY_Z,              // æ
+    0xE7, 0x00, KEY_MOD_RALT,           KEY_COMMA,          // ç
+    0xE9, 0x00, KEY_MOD_RALT,           KEY_E,              // é
+    0xED, 0x00, KEY_MOD_RALT,           KEY_I,              // í
+    0xF0, 0x00, KEY_MOD_RALT,           KEY_D,              // ð
+    0xF1, 0x00, KEY_MOD_RALT,           KEY_N,              // ñ
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_O,              // ó
+    0xF6, 0x00, KEY_MOD_RALT,           KEY_P,              // ö
+    0xF7, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ÷
+    0xF8, 0x00, KEY_MOD_RALT,           KEY_L,              // ø
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_U,              // ú
+    0xFC, 0x00, KEY_MOD_RALT,           KEY_Y,              // ü
+    0xFE, 0x00, KEY_MOD_RALT,           KEY_T,              // þ
+    0x18, 0x20, KEY_MOD_RALT,           KEY_9,              // ‘
+    0x19, 0x20, KEY_MOD_RALT,           KEY_0,              // ’
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NL)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_nl_win[] = {
+    0x22, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // "
+    0x27, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // '
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_SPACE,          // ^
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_A,              // â
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ë
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // ï
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_O,              // ô
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_U,              // û
+    0xFD, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NL)
+inline constexpr hid_locale_t locale_nl_win {
+    ascii_nl_win, sizeof(ascii_nl_win) / 3,
+    utf8_nl_win, sizeof(utf8_nl_win) / 4,
+    combinations_nl_win, sizeof(combinations_nl_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NO)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_no_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x24, KEY_MOD_RALT,           KEY_4,              // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_BACKSLASH,      // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // *
+    0x2B, KEY_NONE,               KEY_MINUS,          // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x5B, KEY_MOD_RALT,           KEY_8,              // [
+    0x5C, KEY_NONE,               KEY_EQUAL,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_9,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_NONE,               KEY_GRAVE,          // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NO)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_no_win[] = {
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_3,              // £
+    0xA4, 0x00, KEY_MOD_LSHIFT,         KEY_4,              // ¤
+    0xA7, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // §
+    0xC5, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Å
+    0xC6, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Æ
+    0xD8, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ø
+    0xE5, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // å
+    0xE6, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // æ
+    0xF8, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ø
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NO)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_no_win[] = {
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD1, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_NO)
+inline constexpr hid_locale_t locale_no_win {
+    ascii_no_win, sizeof(ascii_no_win) / 3,
+    utf8_no_win, sizeof(utf8_no_win) / 4,
+    combinations_no_win, sizeof(combinations_no_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PL)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_pl_win[] = {
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PL)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_pl_win[] = {
+    0xD3, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_O,              // Ó
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_O,              // ó
+    0x04, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_RALT,           KEY_A,              // ą
+    0x06, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_C,              // Ć
+    0x07, 0x01, KEY_MOD_RALT,           KEY_C,              // ć
+    0x18, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_RALT,           KEY_E,              // ę
+    0x41, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_RALT,           KEY_L,              // ł
+    0x43, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_N,              // Ń
+    0x44, 0x01, KEY_MOD_RALT,           KEY_N,              // ń
+    0x5A, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_S,              // Ś
+    0x5B, 0x01, KEY_MOD_RALT,           KEY_S,              // ś
+    0x79, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_X,              // Ź
+    0x7A, 0x01, KEY_MOD_RALT,           KEY_X,              // ź
+    0x7B, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_Z,              // Ż
+    0x7C, 0x01, KEY_MOD_RALT,           KEY_Z,              // ż
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_U               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PL)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_pl_win[] = {
+    0x7E, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PL)
+inline constexpr hid_locale_t locale_pl_win {
+    ascii_pl_win, sizeof(ascii_pl_win) / 3,
+    utf8_pl_win, sizeof(utf8_pl_win) / 4,
+    combinations_pl_win, sizeof(combinations_pl_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_pt_br_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_GRAVE,          // "
+    0x27, KEY_NONE,               KEY_GRAVE,          // '
+    0x2F, KEY_MOD_RALT,           KEY_Q,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_SLASH,          // :
+    0x3B, KEY_NONE,               KEY_SLASH,          // ;
+    0x3F, KEY_MOD_RALT,           KEY_W,              // ?
+    0x5B, KEY_NONE,               KEY_RIGHTBRACE,     // [
+    0x5C, KEY_NONE,               KEY_102ND,          // bslash
+    0x5D, KEY_NONE,               KEY_BACKSLASH,      // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_102ND,          // |
+    0x7D, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // }
+    0x7E, KEY_NONE,               KEY_SPACE           // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_pt_br_win[] = {
+    0xA2, 0x00, KEY_MOD_RALT,           KEY_5,              // ¢
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_4,              // £
+    0xA7, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // §
+    0xAA, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ª
+    0xAC, 0x00, KEY_MOD_RALT,           KEY_6,              // ¬
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_E,              // °
+    0xB2, 0x00, KEY_MOD_RALT,           KEY_2,              // ²
+    0xB3, 0x00, KEY_MOD_RALT,           KEY_3,              // ³
+    0xB9, 0x00, KEY_MOD_RALT,           KEY_1,              // ¹
+    0xBA, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // º
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ç
+    0xE7, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ç
+    0xA2, 0x20, KEY_MOD_RALT,           KEY_C               // ₢
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_pt_br_win[] = {
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ^
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // `
+    0x7E, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_SPACE,          // ~
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_NONE,               KEY_APOSTROPHE,     KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_NONE,               KEY_LEFTBRACE,      KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_LSHIFT,         KEY_6,              KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR)
+inline constexpr hid_locale_t locale_pt_br_win {
+    ascii_pt_br_win, sizeof(ascii_pt_br_win) / 3,
+    utf8_pt_br_win, sizeof(utf8_pt_br_win) / 4,
+    combinations_pt_br_win, sizeof(combinations_pt_br_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_pt_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_NONE,               KEY_MINUS,          // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // *
+    0x2B, KEY_NONE,               KEY_LEFTBRACE,      // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_2,              // @
+    0x5B, KEY_MOD_RALT,           KEY_8,              // [
+    0x5C, KEY_NONE,               KEY_GRAVE,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_9,              // ]
+    0x5E, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_NONE,               KEY_SPACE,          // `
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_GRAVE,          // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_NONE,               KEY_BACKSLASH       // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_pt_win[] = {
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_3,              // £
+    0xA7, 0x00, KEY_MOD_RALT,           KEY_4,              // §
+    0xAA, 0x00, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // ª
+    0xAB, 0x00, KEY_NONE,               KEY_EQUAL,          // «
+    0xBA, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // º
+    0xBB, 0x00, KEY_MOD_LSHIFT,         KEY_EQUAL,          // »
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ç
+    0xE7, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ç
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_5               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_pt_win[] = {
+    0x60, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // `
+    0xA8, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC3, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // Ã
+    0xC4, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD1, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_N,              // Ñ
+    0xD2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD5, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Õ
+    0xD6, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // â
+    0xE3, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // ã
+    0xE4, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ï
+    0xF1, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_N,              // ñ
+    0xF2, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ô
+    0xF5, 0x00, KEY_NONE,               KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // õ
+    0xF6, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_Y               // ÿ
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_PT)
+inline constexpr hid_locale_t locale_pt_win {
+    ascii_pt_win, sizeof(ascii_pt_win) / 3,
+    utf8_pt_win, sizeof(utf8_pt_win) / 4,
+    combinations_pt_win, sizeof(combinations_pt_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RO)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ro_win[] = {
+    0x22, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_APOSTROPHE,     // "
+    0x27, KEY_MOD_RALT,           KEY_APOSTROPHE,     // '
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_COMMA,          // ;
+    0x3C, KEY_MOD_RALT,           KEY_COMMA,          // <
+    0x3E, KEY_MOD_RALT,           KEY_DOT,            // >
+    0x5B, KEY_MOD_RALT,           KEY_LEFTBRACE,      // [
+    0x5C, KEY_NONE,               KEY_102ND,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ]
+    0x60, KEY_MOD_RALT,           KEY_7,              // `
+    0x7B, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_LEFTBRACE,      // {
+    0x7C, KEY_MOD_LSHIFT,         KEY_102ND,          // |
+    0x7D, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_RIGHTBRACE,     // }
+    0x7E, KEY_MOD_RALT,           KEY_1               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RO)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ro_win[] = {
+    0xA7, 0x00, KEY_MOD_RALT,           KEY_P,              // §
+    0xA9, 0x00, KEY_MOD_RALT,           KEY_C,              // ©
+    0xAB, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_COMMA,          // «
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_5,              // °
+    0xB1, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_EQUAL,          // ±
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_9,              // ´
+    0xB8, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ¸
+    0xBB, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_DOT,            // »
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Â
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Î
+    0xDF, 0x00, KEY_MOD_RALT,           KEY_S,              // ß
+    0xE2, 0x00, KEY_NONE,               KEY_BACKSLASH,      // â
+    0xEE, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // î
+    0x02, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ă
+    0x03, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // ă
+    0x10, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_D,              // Đ
+    0x11, 0x01, KEY_MOD_RALT,           KEY_D,              // đ
+    0x41, 0x01, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_RALT,           KEY_L,              // ł
+    0x18, 0x02, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ș
+    0x19, 0x02, KEY_NONE,               KEY_SEMICOLON,      // ș
+    0x1A, 0x02, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ț
+    0x1B, 0x02, KEY_NONE,               KEY_APOSTROPHE,     // ț
+    0x13, 0x20, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_MINUS,          // –
+    0x1D, 0x20, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ”
+    0x1E, 0x20, KEY_NONE,               KEY_GRAVE,          // „
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RO)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_ro_win[] = {
+    0xA8, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_SPACE,          // ¨
+    0xB7, 0x00, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_SPACE,          // ·
+    0xC0, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC4, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC7, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Ç
+    0xC8, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_RALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCF, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_RALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD6, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xD9, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_RALT,           KEY_3,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xDC, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xDD, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_Y,              // Ý
+    0xE0, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_A,              // á
+    0xE4, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_A,              // ä
+    0xE7, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_C,              // ç
+    0xE8, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_NONE,               KEY_E,              // è
+    0xE9, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_E,              // é
+    0xEA, 0x00, KEY_MOD_RALT,           KEY_3,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_I,              // í
+    0xEF, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_RALT,           KEY_3,              KEY_NONE,               KEY_O,              // ô
+    0xF6, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_O,              // ö
+    0xF9, 0x00, KEY_MOD_RALT,           KEY_7,              KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_RALT,           KEY_3,              KEY_NONE,               KEY_U,              // û
+    0xFC, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_U,              // ü
+    0xFD, 0x00, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_Y,              // ý
+    0xFF, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_Y,              // ÿ
+    0x04, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_A,              // ą
+    0x06, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_C,              // ć
+    0x0C, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0D, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_C,              // č
+    0x0E, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_D,              // ď
+    0x18, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_E,              // ę
+    0x1A, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_E,              // ě
+    0x39, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_L,              // Ĺ
+    0x3A, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_L,              // ĺ
+    0x3D, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_L,              // Ľ
+    0x3E, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_L,              // ľ
+    0x43, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_N,              // ń
+    0x47, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_N,              // ň
+    0x50, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_O,              // ő
+    0x54, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_R,              // Ŕ
+    0x55, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_R,              // ŕ
+    0x58, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x59, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_R,              // ř
+    0x5A, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_S,              // ś
+    0x5E, 0x01, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Ş
+    0x5F, 0x01, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_S,              // ş
+    0x60, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_S,              // Š
+    0x61, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_S,              // š
+    0x62, 0x01, KEY_MOD_RALT,           KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_T,              // Ţ
+    0x63, 0x01, KEY_MOD_RALT,           KEY_EQUAL,          KEY_NONE,               KEY_T,              // ţ
+    0x64, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x65, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_T,              // ť
+    0x6E, 0x01, KEY_MOD_RALT,           KEY_5,              KEY_MOD_LSHIFT,         KEY_U,              // Ů
+    0x6F, 0x01, KEY_MOD_RALT,           KEY_5,              KEY_NONE,               KEY_U,              // ů
+    0x70, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_U,              // ű
+    0x78, 0x01, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_Y,              // Ÿ
+    0x79, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_MOD_LSHIFT,         KEY_Z,              // Ź
+    0x7A, 0x01, KEY_MOD_RALT,           KEY_9,              KEY_NONE,               KEY_Z,              // ź
+    0x7B, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_Z,              // Ż
+    0x7C, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_Z,              // ż
+    0x7D, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_Z,              // Ž
+    0x7E, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_Z,              // ž
+    0xC7, 0x02, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_SPACE,          // ˇ
+    0xD8, 0x02, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ˘
+    0xDB, 0x02, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_SPACE,          // ˛
+    0xDD, 0x02, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_SPACE           // ˝
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RO)
+inline constexpr hid_locale_t locale_ro_win {
+    ascii_ro_win, sizeof(ascii_ro_win) / 3,
+    utf8_ro_win, sizeof(utf8_ro_win) / 4,
+    combinations_ro_win, sizeof(combinations_ro_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RU)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ru_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_NONE,               KEY_NONE,           // #
+    0x24, KEY_NONE,               KEY_NONE,           // $
+    0x26, KEY_NONE,               KEY_NONE,           // &
+    0x27, KEY_NONE,               KEY_NONE,           // '
+    0x2C, KEY_MOD_LSHIFT,         KEY_SLASH,          // ,
+    0x2E, KEY_NONE,               KEY_SLASH,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_6,              // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_4,              // ;
+    0x3C, KEY_NONE,               KEY_NONE,           // <
+    0x3E, KEY_NONE,               KEY_NONE,           // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_7,              // ?
+    0x40, KEY_NONE,               KEY_NONE,           // @
+    0x41, KEY_NONE,               KEY_NONE,           // A
+    0x42, KEY_NONE,               KEY_NONE,           // B
+    0x43, KEY_NONE,               KEY_NONE,           // C
+    0x44, KEY_NONE,               KEY_NONE,           // D
+    0x45, KEY_NONE,               KEY_NONE,           // E
+    0x46, KEY_NONE,               KEY_NONE,           // F
+    0x47, KEY_NONE,               KEY_NONE,           // G
+    0x48, KEY_NONE,               KEY_NONE,           // H
+    0x49, KEY_NONE,               KEY_NONE,           // I
+    0x4A, KEY_NONE,               KEY_NONE,           // J
+    0x4B, KEY_NONE,               KEY_NONE,           // K
+    0x4C, KEY_NONE,               KEY_NONE,           // L
+    0x4D, KEY_NONE,               KEY_NONE,           // M
+    0x4E, KEY_NONE,               KEY_NONE,           // N
+    0x4F, KEY_NONE,               KEY_NONE,           // O
+    0x50, KEY_NONE,               KEY_NONE,           // P
+    0x51, KEY_NONE,               KEY_NONE,           // Q
+    0x52, KEY_NONE,               KEY_NONE,           // R
+    0x53, KEY_NONE,               KEY_NONE,           // S
+    0x54, KEY_NONE,               KEY_NONE,           // T
+    0x55, KEY_NONE,               KEY_NONE,           // U
+    0x56, KEY_NONE,               KEY_NONE,           // V
+    0x57, KEY_NONE,               KEY_NONE,           // W
+    0x58, KEY_NONE,               KEY_NONE,           // X
+    0x59, KEY_NONE,               KEY_NONE,           // Y
+    0x5A, KEY_NONE,               KEY_NONE,           // Z
+    0x5B, KEY_NONE,               KEY_NONE,           // [
+    0x5D, KEY_NONE,               KEY_NONE,           // ]
+    0x5E, KEY_NONE,               KEY_NONE,           // ^
+    0x60, KEY_NONE,               KEY_NONE,           // `
+    0x61, KEY_NONE,               KEY_NONE,           // a
+    0x62, KEY_NONE,               KEY_NONE,           // b
+    0x63, KEY_NONE,               KEY_NONE,           // c
+    0x64, KEY_NONE,               KEY_NONE,           // d
+    0x65, KEY_NONE,               KEY_NONE,           // e
+    0x66, KEY_NONE,               KEY_NONE,           // f
+    0x67, KEY_NONE,               KEY_NONE,           // g
+    0x68, KEY_NONE,               KEY_NONE,           // h
+    0x69, KEY_NONE,               KEY_NONE,           // i
+    0x6A, KEY_NONE,               KEY_NONE,           // j
+    0x6B, KEY_NONE,               KEY_NONE,           // k
+    0x6C, KEY_NONE,               KEY_NONE,           // l
+    0x6D, KEY_NONE,               KEY_NONE,           // m
+    0x6E, KEY_NONE,               KEY_NONE,           // n
+    0x6F, KEY_NONE,               KEY_NONE,           // o
+    0x70, KEY_NONE,               KEY_NONE,           // p
+    0x71, KEY_NONE,               KEY_NONE,           // q
+    0x72, KEY_NONE,               KEY_NONE,           // r
+    0x73, KEY_NONE,               KEY_NONE,           // s
+    0x74, KEY_NONE,               KEY_NONE,           // t
+    0x75, KEY_NONE,               KEY_NONE,           // u
+    0x76, KEY_NONE,               KEY_NONE,           // v
+    0x77, KEY_NONE,               KEY_NONE,           // w
+    0x78, KEY_NONE,               KEY_NONE,           // x
+    0x79, KEY_NONE,               KEY_NONE,           // y
+    0x7A, KEY_NONE,               KEY_NONE,           // z
+    0x7B, KEY_NONE,               KEY_NONE,           // {
+    0x7C, KEY_NONE,               KEY_NONE,           // |
+    0x7D, KEY_NONE,               KEY_NONE,           // }
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RU)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ru_win[] = {
+    0x01, 0x04, KEY_MOD_LSHIFT,         KEY_GRAVE,          // Ё
+    0x10, 0x04, KEY_MOD_LSHIFT,         KEY_F,              // А
+    0x11, 0x04, KEY_MOD_LSHIFT,         KEY_COMMA,          // Б
+    0x12, 0x04, KEY_MOD_LSHIFT,         KEY_D,              // В
+    0x13, 0x04, KEY_MOD_LSHIFT,         KEY_U,              // Г
+    0x14, 0x04, KEY_MOD_LSHIFT,         KEY_L,              // Д
+    0x15, 0x04, KEY_MOD_LSHIFT,         KEY_T,              // Е
+    0x16, 0x04, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ж
+    0x17, 0x04, KEY_MOD_LSHIFT,         KEY_P,              // З
+    0x18, 0x04, KEY_MOD_LSHIFT,         KEY_B,              // И
+    0x19, 0x04, KEY_MOD_LSHIFT,         KEY_Q,              // Й
+    0x1A, 0x04, KEY_MOD_LSHIFT,         KEY_R,              // К
+    0x1B, 0x04, KEY_MOD_LSHIFT,         KEY_K,              // Л
+    0x1C, 0x04, KEY_MOD_LSHIFT,         KEY_V,              // М
+    0x1D, 0x04, KEY_MOD_LSHIFT,         KEY_Y,              // Н
+    0x1E, 0x04, KEY_MOD_LSHIFT,         KEY_J,              // О
+    0x1F, 0x04, KEY_MOD_LSHIFT,         KEY_G,              // П
+    0x20, 0x04, KEY_MOD_LSHIFT,         KEY_H,              // Р
+    0x21, 0x04, KEY_MOD_LSHIFT,         KEY_C,              // С
+    0x22, 0x04, KEY_MOD_LSHIFT,         KEY_N,              // Т
+    0x23, 0x04, KEY_MOD_LSHIFT,         KEY_E,              // У
+    0x24, 0x04, KEY_MOD_LSHIFT,         KEY_A,              // Ф
+    0x25, 0x04, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Х
+    0x26, 0x04, KEY_MOD_LSHIFT,         KEY_W,              // Ц
+    0x27, 0x04, KEY_MOD_LSHIFT,         KEY_X,              // Ч
+    0x28, 0x04, KEY_MOD_LSHIFT,         KEY_I,              // Ш
+    0x29, 0x04, KEY_MOD_LSHIFT,         KEY_O,              // Щ
+    0x2A, 0x04, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ъ
+    0x2B, 0x04, KEY_MOD_LSHIFT,         KEY_S,              // Ы
+    0x2C, 0x04, KEY_MOD_LSHIFT,         KEY_M,              // Ь
+    0x2D, 0x04, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Э
+    0x2E, 0x04, KEY_MOD_LSHIFT,         KEY_DOT,            // Ю
+    0x2F, 0x04, KEY_MOD_LSHIFT,         KEY_Z,              // Я
+    0x30, 0x04, KEY_NONE,               KEY_F,              // а
+    0x31, 0x04, KEY_NONE,               KEY_COMMA,          // б
+    0x32, 0x04, KEY_NONE,               KEY_D,              // в
+    0x33, 0x04, KEY_NONE,               KEY_U,              // г
+    0x34, 0x04, KEY_NONE,               KEY_L,              // д
+    0x35, 0x04, KEY_NONE,               KEY_T,              // е
+    0x36, 0x04, KEY_NONE,               KEY_SEMICOLON,      // ж
+    0x37, 0x04, KEY_NONE,               KEY_P,              // з
+    0x38, 0x04, KEY_NONE,               KEY_B,              // и
+    0x39, 0x04, KEY_NONE,               KEY_Q,              // й
+    0x3A, 0x04, KEY_NONE,               KEY_R,              // к
+    0x3B, 0x04, KEY_NONE,               KEY_K,              // л
+    0x3C, 0x04, KEY_NONE,               KEY_V,              // м
+    0x3D, 0x04, KEY_NONE,               KEY_Y,              // н
+    0x3E, 0x04, KEY_NONE,               KEY_J,              // о
+    0x3F, 0x04, KEY_NONE,               KEY_G,              // п
+    0x40, 0x04, KEY_NONE,               KEY_H,              // р
+    0x41, 0x04, KEY_NONE,               KEY_C,              // с
+    0x42, 0x04, KEY_NONE,               KEY_N,              // т
+    0x43, 0x04, KEY_NONE,               KEY_E,              // у
+    0x44, 0x04, KEY_NONE,               KEY_A,              // ф
+    0x45, 0x04, KEY_NONE,               KEY_LEFTBRACE,      // х
+    0x46, 0x04, KEY_NONE,               KEY_W,              // ц
+    0x47, 0x04, KEY_NONE,               KEY_X,              // ч
+    0x48, 0x04, KEY_NONE,               KEY_I,              // ш
+    0x49, 0x04, KEY_NONE,               KEY_O,              // щ
+    0x4A, 0x04, KEY_NONE,               KEY_RIGHTBRACE,     // ъ
+    0x4B, 0x04, KEY_NONE,               KEY_S,              // ы
+    0x4C, 0x04, KEY_NONE,               KEY_M,              // ь
+    0x4D, 0x04, KEY_NONE,               KEY_APOSTROPHE,     // э
+    0x4E, 0x04, KEY_NONE,               KEY_DOT,            // ю
+    0x4F, 0x04, KEY_NONE,               KEY_Z,              // я
+    0x51, 0x04, KEY_NONE,               KEY_GRAVE,          // ё
+    0xBD, 0x20, KEY_MOD_RALT,           KEY_8,              // ₽
+    0x16, 0x21, KEY_MOD_LSHIFT,         KEY_3               // №
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_RU)
+inline constexpr hid_locale_t locale_ru_win {
+    ascii_ru_win, sizeof(ascii_ru_win) / 3,
+    utf8_ru_win, sizeof(utf8_ru_win) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SE)
+inline constexpr hid_locale_t locale_se_win {
+    ascii_fi_win, sizeof(ascii_fi_win) / 3,
+    utf8_fi_win, sizeof(utf8_fi_win) / 4,
+    combinations_fi_win, sizeof(combinations_fi_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SI)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_si_win[] = {
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // ¤
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_5,              // °
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_9,              // ´
+    0xB8, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ¸
+    0xD7, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ×
+    0xDF, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     // ß
+    0xF7, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      // ÷
+    0x06, 0x01, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Ć
+    0x07, 0x01, KEY_NONE,               KEY_APOSTROPHE,     // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Č
+    0x0D, 0x01, KEY_NONE,               KEY_SEMICOLON,      // č
+    0x10, 0x01, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Đ
+    0x11, 0x01, KEY_NONE,               KEY_RIGHTBRACE,     // đ
+    0x41, 0x01, KEY_MOD_RALT,           KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_RALT,           KEY_K,              // ł
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Š
+    0x61, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // š
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // Ž
+    0x7E, 0x01, KEY_NONE,               KEY_BACKSLASH,      // ž
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SI)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_si_win[] = {
+    0xA8, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_SPACE,          // ¨
+    0xC4, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xCB, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xE4, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_A,              // ä
+    0xEB, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_E,              // ë
+    0xF6, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_O,              // ö
+    0xFC, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_U,              // ü
+    0x02, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_A,              // Ă
+    0x03, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_A,              // ă
+    0x04, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_A,              // ą
+    0x0E, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_D,              // ď
+    0x18, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_E,              // ę
+    0x1A, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_E,              // ě
+    0x3D, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_L,              // Ľ
+    0x3E, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_L,              // ľ
+    0x47, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x48, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_N,              // ň
+    0x50, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_O,              // ő
+    0x58, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x59, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_R,              // ř
+    0x64, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x65, 0x01, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_T,              // ť
+    0x70, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_U,              // ű
+    0x7B, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_Y,              // Ż
+    0x7C, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_Y,              // ż
+    0xC7, 0x02, KEY_MOD_RALT,           KEY_2,              KEY_NONE,               KEY_SPACE,          // ˇ
+    0xD8, 0x02, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ˘
+    0xD9, 0x02, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_SPACE,          // ˙
+    0xDB, 0x02, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_SPACE,          // ˛
+    0xDD, 0x02, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_SPACE           // ˝
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SI)
+inline constexpr hid_locale_t locale_si_win {
+    ascii_hr_win, sizeof(ascii_hr_win) / 3,
+    utf8_si_win, sizeof(utf8_si_win) / 4,
+    combinations_si_win, sizeof(combinations_si_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SK)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_sk_win[] = {
+    0x21, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // !
+    0x22, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // "
+    0x23, KEY_MOD_RALT,           KEY_X,              // #
+    0x24, KEY_MOD_RALT,           KEY_SEMICOLON,      // $
+    0x25, KEY_MOD_LSHIFT,         KEY_MINUS,          // %
+    0x26, KEY_NONE,               KEY_102ND,          // &
+    0x27, KEY_MOD_RALT,           KEY_P,              // '
+    0x28, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // (
+    0x29, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // )
+    0x2A, KEY_MOD_LSHIFT,         KEY_102ND,          // *
+    0x2B, KEY_NONE,               KEY_1,              // +
+    0x2D, KEY_NONE,               KEY_SLASH,          // -
+    0x2F, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // /
+    0x30, KEY_MOD_LSHIFT,         KEY_0,              // 0
+    0x31, KEY_MOD_LSHIFT,         KEY_1,              // 1
+    0x32, KEY_MOD_LSHIFT,         KEY_2,              // 2
+    0x33, KEY_MOD_LSHIFT,         KEY_3,              // 3
+    0x34, KEY_MOD_LSHIFT,         KEY_4,              // 4
+    0x35, KEY_MOD_LSHIFT,         KEY_5,              // 5
+    0x36, KEY_MOD_LSHIFT,         KEY_6,              // 6
+    0x37, KEY_MOD_LSHIFT,         KEY_7,              // 7
+    0x38, KEY_MOD_LSHIFT,         KEY_8,              // 8
+    0x39, KEY_MOD_LSHIFT,         KEY_9,              // 9
+    0x3A, KEY_MOD_LSHIFT,         KEY_DOT,            // :
+    0x3B, KEY_NONE,               KEY_GRAVE,          // ;
+    0x3C, KEY_MOD_RALT,           KEY_COMMA,          // <
+    0x3D, KEY_NONE,               KEY_MINUS,          // =
+    0x3E, KEY_MOD_RALT,           KEY_Z,              // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_COMMA,          // ?
+    0x40, KEY_MOD_RALT,           KEY_V,              // @
+    0x59, KEY_MOD_LSHIFT,         KEY_Z,              // Y
+    0x5A, KEY_MOD_LSHIFT,         KEY_Y,              // Z
+    0x5B, KEY_MOD_RALT,           KEY_F,              // [
+    0x5C, KEY_MOD_RALT,           KEY_Q,              // bslash
+    0x5D, KEY_MOD_RALT,           KEY_G,              // ]
+    0x5E, KEY_MOD_RALT,           KEY_3,              // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_SLASH,          // _
+    0x60, KEY_MOD_RALT,           KEY_7,              // `
+    0x79, KEY_NONE,               KEY_Z,              // y
+    0x7A, KEY_NONE,               KEY_Y,              // z
+    0x7B, KEY_MOD_RALT,           KEY_B,              // {
+    0x7C, KEY_MOD_RALT,           KEY_W,              // |
+    0x7D, KEY_MOD_RALT,           KEY_N,              // }
+    0x7E, KEY_MOD_RALT,           KEY_1               // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SK)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_sk_win[] = {
+    0xA4, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      // ¤
+    0xA7, 0x00, KEY_NONE,               KEY_APOSTROPHE,     // §
+    0xB0, 0x00, KEY_MOD_RALT,           KEY_5,              // °
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_9,              // ´
+    0xB8, 0x00, KEY_MOD_RALT,           KEY_EQUAL,          // ¸
+    0xD7, 0x00, KEY_MOD_RALT,           KEY_RIGHTBRACE,     // ×
+    0xDF, 0x00, KEY_MOD_RALT,           KEY_APOSTROPHE,     // ß
+    0xE1, 0x00, KEY_NONE,               KEY_8,              // á
+    0xE4, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ä
+    0xE9, 0x00, KEY_NONE,               KEY_0,              // é
+    0xED, 0x00, KEY_NONE,               KEY_9,              // í
+    0xF4, 0x00, KEY_NONE,               KEY_SEMICOLON,      // ô
+    0xF7, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      // ÷
+    0xFA, 0x00, KEY_NONE,               KEY_LEFTBRACE,      // ú
+    0xFD, 0x00, KEY_NONE,               KEY_7,              // ý
+    0x0D, 0x01, KEY_NONE,               KEY_4,              // č
+    0x10, 0x01, KEY_MOD_RALT,           KEY_D,              // Đ
+    0x11, 0x01, KEY_MOD_RALT,           KEY_S,              // đ
+    0x3E, 0x01, KEY_NONE,               KEY_2,              // ľ
+    0x41, 0x01, KEY_MOD_RALT,           KEY_L,              // Ł
+    0x42, 0x01, KEY_MOD_RALT,           KEY_K,              // ł
+    0x48, 0x01, KEY_NONE,               KEY_BACKSLASH,      // ň
+    0x61, 0x01, KEY_NONE,               KEY_3,              // š
+    0x65, 0x01, KEY_NONE,               KEY_5,              // ť
+    0x7E, 0x01, KEY_NONE,               KEY_6,              // ž
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E               // €
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SK)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_sk_win[] = {
+    0xA8, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_SPACE,          // ¨
+    0xB7, 0x00, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_SPACE,          // ·
+    0xC1, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC4, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC9, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xD3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD6, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_O,              // Ö
+    0xDA, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDC, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_MOD_LSHIFT,         KEY_U,              // Ü
+    0xF3, 0x00, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_O,              // ó
+    0xF6, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_O,              // ö
+    0xFC, 0x00, KEY_MOD_RALT,           KEY_MINUS,          KEY_NONE,               KEY_U,              // ü
+    0x02, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_MOD_LSHIFT,         KEY_A,              // Ă
+    0x03, 0x01, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_A,              // ă
+    0x04, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_A,              // Ą
+    0x05, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_A,              // ą
+    0x06, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Ć
+    0x07, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_C,              // ć
+    0x0C, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_C,              // Č
+    0x0E, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_D,              // Ď
+    0x0F, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_D,              // ď
+    0x18, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_MOD_LSHIFT,         KEY_E,              // Ę
+    0x19, 0x01, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_E,              // ę
+    0x1A, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_E,              // Ě
+    0x1B, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_E,              // ě
+    0x39, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ĺ
+    0x3A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_L,              // ĺ
+    0x3D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_L,              // Ľ
+    0x43, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ń
+    0x44, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_N,              // ń
+    0x47, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_N,              // Ň
+    0x50, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_O,              // Ő
+    0x51, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_O,              // ő
+    0x54, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ŕ
+    0x55, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_R,              // ŕ
+    0x58, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_R,              // Ř
+    0x59, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_R,              // ř
+    0x5A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Ś
+    0x5B, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_S,              // ś
+    0x60, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_S,              // Š
+    0x64, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_T,              // Ť
+    0x6E, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_MOD_LSHIFT,         KEY_U,              // Ů
+    0x6F, 0x01, KEY_MOD_LSHIFT,         KEY_GRAVE,          KEY_NONE,               KEY_U,              // ů
+    0x70, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_MOD_LSHIFT,         KEY_U,              // Ű
+    0x71, 0x01, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_U,              // ű
+    0x79, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ź
+    0x7A, 0x01, KEY_NONE,               KEY_EQUAL,          KEY_NONE,               KEY_Y,              // ź
+    0x7B, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_MOD_LSHIFT,         KEY_Y,              // Ż
+    0x7C, 0x01, KEY_MOD_RALT,           KEY_8,              KEY_NONE,               KEY_Y,              // ż
+    0x7D, 0x01, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_MOD_LSHIFT,         KEY_Y,              // Ž
+    0xC7, 0x02, KEY_MOD_LSHIFT,         KEY_EQUAL,          KEY_NONE,               KEY_SPACE,          // ˇ
+    0xD8, 0x02, KEY_MOD_RALT,           KEY_4,              KEY_NONE,               KEY_SPACE,          // ˘
+    0xDB, 0x02, KEY_MOD_RALT,           KEY_6,              KEY_NONE,               KEY_SPACE,          // ˛
+    0xDD, 0x02, KEY_MOD_RALT,           KEY_0,              KEY_NONE,               KEY_SPACE           // ˝
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_SK)
+inline constexpr hid_locale_t locale_sk_win {
+    ascii_sk_win, sizeof(ascii_sk_win) / 3,
+    utf8_sk_win, sizeof(utf8_sk_win) / 4,
+    combinations_sk_win, sizeof(combinations_sk_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_TR)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_tr_win[] = {
+    0x22, KEY_NONE,               KEY_GRAVE,          // "
+    0x23, KEY_MOD_RALT,           KEY_3,              // #
+    0x24, KEY_MOD_RALT,           KEY_4,              // $
+    0x26, KEY_MOD_LSHIFT,         KEY_6,              // &
+    0x27, KEY_MOD_LSHIFT,         KEY_2,              // '
+    0x28, KEY_MOD_LSHIFT,         KEY_8,              // (
+    0x29, KEY_MOD_LSHIFT,         KEY_9,              // )
+    0x2A, KEY_NONE,               KEY_MINUS,          // *
+    0x2B, KEY_MOD_LSHIFT,         KEY_4,              // +
+    0x2C, KEY_NONE,               KEY_BACKSLASH,      // ,
+    0x2D, KEY_NONE,               KEY_EQUAL,          // -
+    0x2E, KEY_NONE,               KEY_SLASH,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_7,              // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_SLASH,          // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // ;
+    0x3C, KEY_NONE,               KEY_102ND,          // <
+    0x3D, KEY_MOD_LSHIFT,         KEY_0,              // =
+    0x3E, KEY_MOD_LSHIFT,         KEY_102ND,          // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_MINUS,          // ?
+    0x40, KEY_MOD_RALT,           KEY_Q,              // @
+    0x5B, KEY_MOD_RALT,           KEY_8,              // [
+    0x5C, KEY_MOD_RALT,           KEY_MINUS,          // bslash
+    0x5D, KEY_MOD_RALT,           KEY_9,              // ]
+    0x5E, KEY_NONE,               KEY_SPACE,          // ^
+    0x5F, KEY_MOD_LSHIFT,         KEY_EQUAL,          // _
+    0x60, KEY_MOD_RALT,           KEY_BACKSLASH,      // `
+    0x69, KEY_NONE,               KEY_APOSTROPHE,     // i
+    0x7B, KEY_MOD_RALT,           KEY_7,              // {
+    0x7C, KEY_MOD_RALT,           KEY_EQUAL,          // |
+    0x7D, KEY_MOD_RALT,           KEY_0,              // }
+    0x7E, KEY_MOD_RALT,           KEY_RIGHTBRACE      // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_TR)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_tr_win[] = {
+    0xA3, 0x00, KEY_MOD_RALT,           KEY_2,              // £
+    0xBD, 0x00, KEY_MOD_RALT,           KEY_5,              // ½
+    0xC6, 0x00, (KEY_MOD_RALT|KEY_MOD_LSHIFT), KEY_A,              // Æ
+    0xC7, 0x00, KEY_MOD_LSHIFT,         KEY_DOT,            // Ç
+    0xD6, 0x00, KEY_MOD_LSHIFT,         KEY_COMMA,          // Ö
+    0xDC, 0x00, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ü
+    0xDF, 0x00, KEY_MOD_RALT,           KEY_S,              // ß
+    0xE6, 0x00, KEY_MOD_RALT,           KEY_A,              // æ
+    0xE7, 0x00, KEY_NONE,               KEY_DOT,            // ç
+    0xE9, 0x00, KEY_MOD_LSHIFT,         KEY_GRAVE,          // é
+    0xF6, 0x00, KEY_NONE,               KEY_COMMA,          // ö
+    0xFC, 0x00, KEY_NONE,               KEY_RIGHTBRACE,     // ü
+    0x1E, 0x01, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Ğ
+    0x1F, 0x01, KEY_NONE,               KEY_LEFTBRACE,      // ğ
+    0x30, 0x01, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // İ
+    0x31, 0x01, KEY_NONE,               KEY_I,              // ı
+    0x5E, 0x01, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ş
+    0x5F, 0x01, KEY_NONE,               KEY_SEMICOLON,      // ş
+    0xAC, 0x20, KEY_MOD_RALT,           KEY_E,              // €
+    0xBA, 0x20, KEY_MOD_RALT,           KEY_T               // ₺
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_TR)
+// Code point (little endian), Modifier(s), Key, Modifier(s), Key
+inline constexpr uint8_t combinations_tr_win[] = {
+    0x5E, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_SPACE,          // ^
+    0xA8, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_SPACE,          // ¨
+    0xB4, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_SPACE,          // ´
+    0xC0, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_A,              // À
+    0xC1, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_A,              // Á
+    0xC2, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_MOD_LSHIFT,         KEY_A,              // Â
+    0xC4, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_A,              // Ä
+    0xC8, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_E,              // È
+    0xC9, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_E,              // É
+    0xCA, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_MOD_LSHIFT,         KEY_E,              // Ê
+    0xCB, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_E,              // Ë
+    0xCC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_I,              // Ì
+    0xCD, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_I,              // Í
+    0xCE, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_MOD_LSHIFT,         KEY_I,              // Î
+    0xCF, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_MOD_LSHIFT,         KEY_I,              // Ï
+    0xD2, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_O,              // Ò
+    0xD3, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_O,              // Ó
+    0xD4, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_MOD_LSHIFT,         KEY_O,              // Ô
+    0xD9, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_MOD_LSHIFT,         KEY_U,              // Ù
+    0xDA, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_MOD_LSHIFT,         KEY_U,              // Ú
+    0xDB, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_MOD_LSHIFT,         KEY_U,              // Û
+    0xE0, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_A,              // à
+    0xE1, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_A,              // á
+    0xE2, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_A,              // â
+    0xE4, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_A,              // ä
+    0xE8, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_E,              // è
+    0xEA, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_E,              // ê
+    0xEB, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_E,              // ë
+    0xEC, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_I,              // ì
+    0xED, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_I,              // í
+    0xEE, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_I,              // î
+    0xEF, 0x00, KEY_MOD_RALT,           KEY_LEFTBRACE,      KEY_NONE,               KEY_I,              // ï
+    0xF2, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_O,              // ò
+    0xF3, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_O,              // ó
+    0xF4, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_O,              // ô
+    0xF9, 0x00, KEY_MOD_RALT,           KEY_BACKSLASH,      KEY_NONE,               KEY_U,              // ù
+    0xFA, 0x00, KEY_MOD_RALT,           KEY_SEMICOLON,      KEY_NONE,               KEY_U,              // ú
+    0xFB, 0x00, KEY_MOD_LSHIFT,         KEY_3,              KEY_NONE,               KEY_U               // û
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_TR)
+inline constexpr hid_locale_t locale_tr_win {
+    ascii_tr_win, sizeof(ascii_tr_win) / 3,
+    utf8_tr_win, sizeof(utf8_tr_win) / 4,
+    combinations_tr_win, sizeof(combinations_tr_win) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_UA)
+// Char, Modifier(s), Key
+inline constexpr uint8_t ascii_ua_win[] = {
+    0x22, KEY_MOD_LSHIFT,         KEY_2,              // "
+    0x23, KEY_NONE,               KEY_NONE,           // #
+    0x24, KEY_NONE,               KEY_NONE,           // $
+    0x26, KEY_NONE,               KEY_NONE,           // &
+    0x27, KEY_NONE,               KEY_GRAVE,          // '
+    0x2C, KEY_MOD_LSHIFT,         KEY_SLASH,          // ,
+    0x2E, KEY_NONE,               KEY_SLASH,          // .
+    0x2F, KEY_MOD_LSHIFT,         KEY_BACKSLASH,      // /
+    0x3A, KEY_MOD_LSHIFT,         KEY_6,              // :
+    0x3B, KEY_MOD_LSHIFT,         KEY_4,              // ;
+    0x3C, KEY_NONE,               KEY_NONE,           // <
+    0x3E, KEY_NONE,               KEY_NONE,           // >
+    0x3F, KEY_MOD_LSHIFT,         KEY_7,              // ?
+    0x40, KEY_NONE,               KEY_NONE,           // @
+    0x41, KEY_NONE,               KEY_NONE,           // A
+    0x42, KEY_NONE,               KEY_NONE,           // B
+    0x43, KEY_NONE,               KEY_NONE,           // C
+    0x44, KEY_NONE,               KEY_NONE,           // D
+    0x45, KEY_NONE,               KEY_NONE,           // E
+    0x46, KEY_NONE,               KEY_NONE,           // F
+    0x47, KEY_NONE,               KEY_NONE,           // G
+    0x48, KEY_NONE,               KEY_NONE,           // H
+    0x49, KEY_NONE,               KEY_NONE,           // I
+    0x4A, KEY_NONE,               KEY_NONE,           // J
+    0x4B, KEY_NONE,               KEY_NONE,           // K
+    0x4C, KEY_NONE,               KEY_NONE,           // L
+    0x4D, KEY_NONE,               KEY_NONE,           // M
+    0x4E, KEY_NONE,               KEY_NONE,           // N
+    0x4F, KEY_NONE,               KEY_NONE,           // O
+    0x50, KEY_NONE,               KEY_NONE,           // P
+    0x51, KEY_NONE,               KEY_NONE,           // Q
+    0x52, KEY_NONE,               KEY_NONE,           // R
+    0x53, KEY_NONE,               KEY_NONE,           // S
+    0x54, KEY_NONE,               KEY_NONE,           // T
+    0x55, KEY_NONE,               KEY_NONE,           // U
+    0x56, KEY_NONE,               KEY_NONE,           // V
+    0x57, KEY_NONE,               KEY_NONE,           // W
+    0x58, KEY_NONE,               KEY_NONE,           // X
+    0x59, KEY_NONE,               KEY_NONE,           // Y
+    0x5A, KEY_NONE,               KEY_NONE,           // Z
+    0x5B, KEY_NONE,               KEY_NONE,           // [
+    0x5D, KEY_NONE,               KEY_NONE,           // ]
+    0x5E, KEY_NONE,               KEY_NONE,           // ^
+    0x60, KEY_NONE,               KEY_NONE,           // `
+    0x61, KEY_NONE,               KEY_NONE,           // a
+    0x62, KEY_NONE,               KEY_NONE,           // b
+    0x63, KEY_NONE,               KEY_NONE,           // c
+    0x64, KEY_NONE,               KEY_NONE,           // d
+    0x65, KEY_NONE,               KEY_NONE,           // e
+    0x66, KEY_NONE,               KEY_NONE,           // f
+    0x67, KEY_NONE,               KEY_NONE,           // g
+    0x68, KEY_NONE,               KEY_NONE,           // h
+    0x69, KEY_NONE,               KEY_NONE,           // i
+    0x6A, KEY_NONE,               KEY_NONE,           // j
+    0x6B, KEY_NONE,               KEY_NONE,           // k
+    0x6C, KEY_NONE,               KEY_NONE,           // l
+    0x6D, KEY_NONE,               KEY_NONE,           // m
+    0x6E, KEY_NONE,               KEY_NONE,           // n
+    0x6F, KEY_NONE,               KEY_NONE,           // o
+    0x70, KEY_NONE,               KEY_NONE,           // p
+    0x71, KEY_NONE,               KEY_NONE,           // q
+    0x72, KEY_NONE,               KEY_NONE,           // r
+    0x73, KEY_NONE,               KEY_NONE,           // s
+    0x74, KEY_NONE,               KEY_NONE,           // t
+    0x75, KEY_NONE,               KEY_NONE,           // u
+    0x76, KEY_NONE,               KEY_NONE,           // v
+    0x77, KEY_NONE,               KEY_NONE,           // w
+    0x78, KEY_NONE,               KEY_NONE,           // x
+    0x79, KEY_NONE,               KEY_NONE,           // y
+    0x7A, KEY_NONE,               KEY_NONE,           // z
+    0x7B, KEY_NONE,               KEY_NONE,           // {
+    0x7C, KEY_NONE,               KEY_NONE,           // |
+    0x7D, KEY_NONE,               KEY_NONE,           // }
+    0x7E, KEY_NONE,               KEY_NONE            // ~
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_UA)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_ua_win[] = {
+    0x04, 0x04, KEY_MOD_LSHIFT,         KEY_APOSTROPHE,     // Є
+    0x06, 0x04, KEY_MOD_LSHIFT,         KEY_S,              // І
+    0x07, 0x04, KEY_MOD_LSHIFT,         KEY_RIGHTBRACE,     // Ї
+    0x10, 0x04, KEY_MOD_LSHIFT,         KEY_F,              // А
+    0x11, 0x04, KEY_MOD_LSHIFT,         KEY_COMMA,          // Б
+    0x12, 0x04, KEY_MOD_LSHIFT,         KEY_D,              // В
+    0x13, 0x04, KEY_MOD_LSHIFT,         KEY_U,              // Г
+    0x14, 0x04, KEY_MOD_LSHIFT,         KEY_L,              // Д
+    0x15, 0x04, KEY_MOD_LSHIFT,         KEY_T,              // Е
+    0x16, 0x04, KEY_MOD_LSHIFT,         KEY_SEMICOLON,      // Ж
+    0x17, 0x04, KEY_MOD_LSHIFT,         KEY_P,              // З
+    0x18, 0x04, KEY_MOD_LSHIFT,         KEY_B,              // И
+    0x19, 0x04, KEY_MOD_LSHIFT,         KEY_Q,              // Й
+    0x1A, 0x04, KEY_MOD_LSHIFT,         KEY_R,              // К
+    0x1B, 0x04, KEY_MOD_LSHIFT,         KEY_K,              // Л
+    0x1C, 0x04, KEY_MOD_LSHIFT,         KEY_V,              // М
+    0x1D, 0x04, KEY_MOD_LSHIFT,         KEY_Y,              // Н
+    0x1E, 0x04, KEY_MOD_LSHIFT,         KEY_J,              // О
+    0x1F, 0x04, KEY_MOD_LSHIFT,         KEY_G,              // П
+    0x20, 0x04, KEY_MOD_LSHIFT,         KEY_H,              // Р
+    0x21, 0x04, KEY_MOD_LSHIFT,         KEY_C,              // С
+    0x22, 0x04, KEY_MOD_LSHIFT,         KEY_N,              // Т
+    0x23, 0x04, KEY_MOD_LSHIFT,         KEY_E,              // У
+    0x24, 0x04, KEY_MOD_LSHIFT,         KEY_A,              // Ф
+    0x25, 0x04, KEY_MOD_LSHIFT,         KEY_LEFTBRACE,      // Х
+    0x26, 0x04, KEY_MOD_LSHIFT,         KEY_W,              // Ц
+    0x27, 0x04, KEY_MOD_LSHIFT,         KEY_X,              // Ч
+    0x28, 0x04, KEY_MOD_LSHIFT,         KEY_I,              // Ш
+    0x29, 0x04, KEY_MOD_LSHIFT,         KEY_O,              // Щ
+    0x2C, 0x04, KEY_MOD_LSHIFT,         KEY_M,              // Ь
+    0x2E, 0x04, KEY_MOD_LSHIFT,         KEY_DOT,            // Ю
+    0x2F, 0x04, KEY_MOD_LSHIFT,         KEY_Z,              // Я
+    0x30, 0x04, KEY_NONE,               KEY_F,              // а
+    0x31, 0x04, KEY_NONE,               KEY_COMMA,          // б
+    0x32, 0x04, KEY_NONE,               KEY_D,              // в
+    0x33, 0x04, KEY_NONE,               KEY_U,              // г
+    0x34, 0x04, KEY_NONE,               KEY_L,              // д
+    0x35, 0x04, KEY_NONE,               KEY_T,              // е
+    0x36, 0x04, KEY_NONE,               KEY_SEMICOLON,      // ж
+    0x37, 0x04, KEY_NONE,               KEY_P,              // з
+    0x38, 0x04, KEY_NONE,               KEY_B,              // и
+    0x39, 0x04, KEY_NONE,               KEY_Q,              // й
+    0x3A, 0x04, KEY_NONE,               KEY_R,              // к
+    0x3B, 0x04, KEY_NONE,               KEY_K,              // л
+    0x3C, 0x04, KEY_NONE,               KEY_V,              // м
+    0x3D, 0x04, KEY_NONE,               KEY_Y,              // н
+    0x3E, 0x04, KEY_NONE,               KEY_J,              // о
+    0x3F, 0x04, KEY_NONE,               KEY_G,              // п
+    0x40, 0x04, KEY_NONE,               KEY_H,              // р
+    0x41, 0x04, KEY_NONE,               KEY_C,              // с
+    0x42, 0x04, KEY_NONE,               KEY_N,              // т
+    0x43, 0x04, KEY_NONE,               KEY_E,              // у
+    0x44, 0x04, KEY_NONE,               KEY_A,              // ф
+    0x45, 0x04, KEY_NONE,               KEY_LEFTBRACE,      // х
+    0x46, 0x04, KEY_NONE,               KEY_W,              // ц
+    0x47, 0x04, KEY_NONE,               KEY_X,              // ч
+    0x48, 0x04, KEY_NONE,               KEY_I,              // ш
+    0x49, 0x04, KEY_NONE,               KEY_O,              // щ
+    0x4C, 0x04, KEY_NONE,               KEY_M,              // ь
+    0x4E, 0x04, KEY_NONE,               KEY_DOT,            // ю
+    0x4F, 0x04, KEY_NONE,               KEY_Z,              // я
+    0x54, 0x04, KEY_NONE,               KEY_APOSTROPHE,     // є
+    0x56, 0x04, KEY_NONE,               KEY_S,              // і
+    0x57, 0x04, KEY_NONE,               KEY_RIGHTBRACE,     // ї
+    0x90, 0x04, KEY_MOD_LSHIFT,         KEY_102ND,          // Ґ
+    0x91, 0x04, KEY_NONE,               KEY_102ND,          // ґ
+    0xB4, 0x20, KEY_MOD_LSHIFT,         KEY_GRAVE,          // ₴
+    0x16, 0x21, KEY_MOD_LSHIFT,         KEY_3               // №
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_UA)
+inline constexpr hid_locale_t locale_ua_win {
+    ascii_ua_win, sizeof(ascii_ua_win) / 3,
+    utf8_ua_win, sizeof(utf8_ua_win) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_US)
+// Code point (little endian), Modifier(s), Key
+inline constexpr uint8_t utf8_us_win[] = {
+};
+#endif
+
+#if defined(LOCALE_ALL) || defined(LOCALE_US)
+inline constexpr hid_locale_t locale_us_win {
+    ascii_in_win, sizeof(ascii_in_win) / 3,
+    utf8_us_win, sizeof(utf8_us_win) / 4,
+    combinations_ru_mac, sizeof(combinations_ru_mac) / 6,
+};
+#endif
+
+// Names for locale::get(), sorted
+inline constexpr hid_locale_name_t locale_names[] = {
+#if defined(LOCALE_ALL) || defined(LOCALE_BE)
+    { "BE", &locale_be_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_BE_MAC)
+    { "BE_MAC", &locale_be_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_BG)
+    { "BG", &locale_bg_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_BG_MAC)
+    { "BG_MAC", &locale_bg_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_CMS)
+    { "CA_CMS", &locale_ca_cms_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR)
+    { "CA_FR", &locale_ca_fr_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CA_FR_MAC)
+    { "CA_FR_MAC", &locale_ca_fr_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE)
+    { "CH_DE", &locale_ch_de_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_DE_MAC)
+    { "CH_DE_MAC", &locale_ch_de_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_FR)
+    { "CH_FR", &locale_ch_fr_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CH_FR_MAC)
+    { "CH_FR_MAC", &locale_ch_fr_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ)
+    { "CZ", &locale_cz_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_CZ_MAC)
+    { "CZ_MAC", &locale_cz_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_DE)
+    { "DE", &locale_de_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_DE_MAC)
+    { "DE_MAC", &locale_de_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_DK)
+    { "DK", &locale_dk_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_DK_MAC)
+    { "DK_MAC", &locale_dk_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_EE)
+    { "EE", &locale_ee_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_EE_MAC)
+    { "EE_MAC", &locale_ee_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_ES)
+    { "ES", &locale_es_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA)
+    { "ES_LA", &locale_es_la_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_LA_MAC)
+    { "ES_LA_MAC", &locale_es_la_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_ES_MAC)
+    { "ES_MAC", &locale_es_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_FI)
+    { "FI", &locale_fi_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_FI_MAC)
+    { "FI_MAC", &locale_fi_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_FR)
+    { "FR", &locale_fr_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_FR_MAC)
+    { "FR_MAC", &locale_fr_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_GB)
+    { "GB", &locale_gb_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_GB_MAC)
+    { "GB_MAC", &locale_gb_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_GR)
+    { "GR", &locale_gr_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_GR_MAC)
+    { "GR_MAC", &locale_gr_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_HR)
+    { "HR", &locale_hr_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_HR_MAC)
+    { "HR_MAC", &locale_hr_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_HU)
+    { "HU", &locale_hu_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_HU_MAC)
+    { "HU_MAC", &locale_hu_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_IE)
+    { "IE", &locale_ie_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_IN)
+    { "IN", &locale_in_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_IN_MAC)
+    { "IN_MAC", &locale_in_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_IS)
+    { "IS", &locale_is_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_IS_MAC)
+    { "IS_MAC", &locale_is_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_IT)
+    { "IT", &locale_it_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_IT_MAC)
+    { "IT_MAC", &locale_it_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_LT)
+    { "LT", &locale_lt_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_LT_MAC)
+    { "LT_MAC", &locale_lt_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_LV)
+    { "LV", &locale_lv_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_LV_MAC)
+    { "LV_MAC", &locale_lv_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_NL)
+    { "NL", &locale_nl_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_NL_MAC)
+    { "NL_MAC", &locale_nl_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_NO)
+    { "NO", &locale_no_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_NO_MAC)
+    { "NO_MAC", &locale_no_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_PL)
+    { "PL", &locale_pl_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_PL_MAC)
+    { "PL_MAC", &locale_pl_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_PT)
+    { "PT", &locale_pt_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR)
+    { "PT_BR", &locale_pt_br_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_BR_MAC)
+    { "PT_BR_MAC", &locale_pt_br_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_PT_MAC)
+    { "PT_MAC", &locale_pt_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_RO)
+    { "RO", &locale_ro_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_RO_MAC)
+    { "RO_MAC", &locale_ro_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_RU)
+    { "RU", &locale_ru_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_RU_MAC)
+    { "RU_MAC", &locale_ru_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_SE)
+    { "SE", &locale_se_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_SE_MAC)
+    { "SE_MAC", &locale_se_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_SI)
+    { "SI", &locale_si_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_SI_MAC)
+    { "SI_MAC", &locale_si_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_SK)
+    { "SK", &locale_sk_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_SK_MAC)
+    { "SK_MAC", &locale_sk_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_TR)
+    { "TR", &locale_tr_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_TR_MAC)
+    { "TR_MAC", &locale_tr_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_UA)
+    { "UA", &locale_ua_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_UA_MAC)
+    { "UA_MAC", &locale_ua_mac },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_US)
+    { "US", &locale_us_win },
+#endif
+#if defined(LOCALE_ALL) || defined(LOCALE_US_MAC)
+    { "US_MAC", &locale_us_mac },
+#endif
+};
\ No newline at end of file
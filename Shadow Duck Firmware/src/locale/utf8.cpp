@@ -0,0 +1,65 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#include "locale/utf8.h"
+
+namespace utf8 {
+    // ====== PRIVATE ====== //
+    // Smallest code point of a character with this many bytes, smaller ones are overlong
+    const uint32_t min_code[] = { 0, 0, 0x80, 0x800, 0x10000 };
+
+    // ====== PUBLIC ====== //
+    bool feed(decoder_t* d, uint8_t b, uint32_t* code) {
+        if (d->needed > 0) {
+            if ((b & 0xC0) == 0x80) {
+                d->code = (d->code << 6) | (b & 0x3F);
+
+                if (--d->needed > 0) return false;
+
+                // Overlong, UTF-16 surrogate or out of range
+                if ((d->code < min_code[d->len]) || ((d->code >= 0xD800) && (d->code <= 0xDFFF)) || (d->code > 0x10FFFF)) {
+                    return false;
+                }
+
+                *code = d->code;
+                return true;
+            }
+
+            // Sequence ended too early, drop it and start over with this byte
+            d->needed = 0;
+        }
+
+        if (b < 0x80) {
+            *code = b;
+            return true;
+        } else if ((b & 0xE0) == 0xC0) {
+            d->code   = b & 0x1F;
+            d->len    = 2;
+            d->needed = 1;
+        } else if ((b & 0xF0) == 0xE0) {
+            d->code   = b & 0x0F;
+            d->len    = 3;
+            d->needed = 2;
+        } else if ((b & 0xF8) == 0xF0) {
+            d->code   = b & 0x07;
+            d->len    = 4;
+            d->needed = 3;
+        }
+
+        // Continuation byte without a start, or not a valid UTF-8 byte at all
+        return false;
+    }
+
+    size_t decode(const char* str, size_t len, uint32_t* code) {
+        decoder_t d = { 0, 0, 0 };
+
+        for (size_t i = 0; i < len && i < 4; ++i) {
+            // Don't let a truncated character run into the next one
+            if ((i > 0) && ((str[i] & 0xC0) != 0x80)) return 0;
+
+            if (feed(&d, (uint8_t)str[i], code)) return i + 1;
+            if (d.needed == 0) return 0;
+        }
+
+        return 0;
+    }
+}
\ No newline at end of file
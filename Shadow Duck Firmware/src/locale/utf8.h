@@ -0,0 +1,23 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#pragma once
+
+#include <cstdint> // uint8_t, uint32_t
+#include <cstddef> // size_t
+
+namespace utf8 {
+    // State of a character that is decoded byte by byte,
+    // so a character may be split across buffers
+    typedef struct decoder_t {
+        uint32_t code;
+        uint8_t  len;    // Bytes of the character
+        uint8_t  needed; // Continuation bytes that are still missing
+    } decoder_t;
+
+    // Returns true if b completed a character, its Unicode code point is written to code.
+    // Invalid bytes (overlong, surrogates, missing continuation, ...) are skipped.
+    bool feed(decoder_t* d, uint8_t b, uint32_t* code);
+
+    // Decode the first character of str, returns the number of bytes it takes (0 if it's invalid)
+    size_t decode(const char* str, size_t len, uint32_t* code);
+}
\ No newline at end of file
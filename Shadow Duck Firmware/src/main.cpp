@@ -9,14 +9,50 @@
 #include "msc/msc.h"
 #include "selector/selector.h"
 #include "attack/attack.h"
+#include "attack/prefetch.h"
 #include "preferences/preferences.h"
 #include "duckparser/duckparser.h"
 #include "tasks/tasks.h"
 #include "cli/cli.h"
+#include "events/events.h"
 
-void update() {
-    led::update();
-    // cli::update();
+#if defined(ARDUINO_ARCH_RP2040)
+#include <hardware/sync.h> // __wfe()
+#endif // if defined(ARDUINO_ARCH_RP2040)
+
+// Boot phases (millis since reset), the time until the first keystroke is what counts
+typedef struct phase_t {
+    const char* name;
+    uint32_t    time;
+} phase_t;
+
+phase_t phases[8];
+uint8_t phase_count = 0;
+
+void phase(const char* name) {
+    if (phase_count < 8) phases[phase_count++] = phase_t{ name, (uint32_t)millis() };
+}
+
+void print_phases() {
+    for (uint8_t i = 0; i < phase_count; ++i) {
+        debug(phases[i].name);
+        debugF(": ");
+        debug(phases[i].time);
+        debuglnF(" ms");
+    }
+
+    debugF("Host ready: ");
+    debug(hid::getReadyTime());
+    debuglnF(" ms");
+
+    debugF("First report: ");
+    debug(hid::getFirstReportTime());
+    debuglnF(" ms");
+}
+
+// The host wrote to the drive, so the settings snapshot may be outdated
+void check_drive() {
+    if (msc::changed()) preferences::invalidate();
 }
 
 void setup() {
@@ -28,6 +64,7 @@ void setup() {
         led::setColor(255, 0, 0, 200);
         return;
     }
+    phase("Flash");
 
     // Read mode from selector switch
     selector::init();
@@ -41,11 +78,14 @@ void setup() {
     hid::setSerial(preferences::getSerial());
     hid::setManufacturer(preferences::getManufacturer());
     hid::setProduct(preferences::getProduct());
+    hid::setNKRO(preferences::nkroEnabled());
+    phase("Preferences");
 
     // Start Keyboard
     if ((selector::mode() == ATTACK) || preferences::hidEnabled()) {
         hid::init();
     }
+    phase("USB");
 
     // Start USB Drive
     if (preferences::mscEnabled() || (selector::mode() == SETUP)) {
@@ -63,13 +103,13 @@ void setup() {
     }
 
     // Attack settings
-    keyboard::setLocale(locale::get(preferences::getDefaultLayout().c_str()));
+    keyboard::setLocale(locale::get(preferences::getDefaultLayout()));
     duckparser::setDefaultDelay(preferences::getDefaultDelay());
 
     // Format Flash (if specified in preferences.json)
     if ((selector::mode() == SETUP) && preferences::getFormat()) {
         led::setColor(255, 255, 255);
-        msc::format(preferences::getDriveName().c_str());
+        msc::format(preferences::getDriveName());
     }
 
     // Create preferences file if it doesn't exist yet
@@ -78,23 +118,30 @@ void setup() {
     }
 
     // Create main_script.txt if it doesn't exist yet
-    if (!msc::exists(preferences::getMainScript().c_str())) {
+    if (!msc::exists(preferences::getMainScript())) {
         char message[21];
         sprintf(message, "# ShadowDuck (v%s)\n", VERSION);
-        msc::write(preferences::getMainScript().c_str(), message, 20);
+        msc::write(preferences::getMainScript(), message, 20);
     }
 
-    // Setup background tasks
-    tasks::setCallback(update);
+    phase("Files");
+
+    // Setup background tasks (LED and selector add their own)
+    tasks::add("drive", check_drive, 100);
 
     // Make sure we don't start with a mode change
     selector::changed();
 
     // Start attack
     if ((selector::mode() == ATTACK) && !preferences::getRunOnIndicator()) {
-        delay(preferences::getInitialDelay());      // Wait to give computer time to init keyboard
-        attack::start();                            // Start keystroke injection attack
+        if (preferences::getFastStart()) {
+            attack::startWhenReady(preferences::getInitialDelay()); // Start as soon as the computer is ready
+        } else {
+            delay(preferences::getInitialDelay()); // Wait to give computer time to init keyboard
+            attack::start();                       // Start keystroke injection attack
+        }
         led::setColor(preferences::getIdleColor()); // Set LED to green
+        phase("Attack");
     }
 
     // Setup CLI
@@ -103,9 +150,25 @@ void setup() {
 #endif // ifdef ENABLE_DEBUG
 
     debugln("[Started]");
+    print_phases();
 }
 
+#if defined(ARDUINO_ARCH_RP2040)
+// Core1 reads and compiles the upcoming lines of a script, while core0 types them
+void setup1() {}
+
+void loop1() {
+    // Sleep until prefetch::start() or release() (or any other event) wakes the core
+    if (!prefetch::update()) __wfe();
+}
+#endif // if defined(ARDUINO_ARCH_RP2040)
+
 void loop() {
+    // Sleep until something happens (selector, indicator, drive, serial) or a task is due.
+    // The handlers below check their own state.
+    events::wait(tasks::next());
+    events::take();
+
     tasks::update();
     cli::update();
 
@@ -122,7 +185,7 @@ void loop() {
             preferences::load(); // Reload the settings (in case the main script path changed)
 
             // Attack settings
-            keyboard::setLocale(locale::get(preferences::getDefaultLayout().c_str()));
+            keyboard::setLocale(locale::get(preferences::getDefaultLayout()));
             duckparser::setDefaultDelay(preferences::getDefaultDelay());
 
             attack::start();                             // Start keystroke injection attack
@@ -0,0 +1,414 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#include "msc/cache.h"
+
+#include "config.h"
+#include "debug.h"
+
+#include <Arduino.h> // micros()
+#include <string.h>  // memcpy
+
+#include <SdFat.h>
+#include <Adafruit_SPIFlash.h>
+
+#define BLOCK_SIZE 512
+#define SECTOR_SIZE SFLASH_SECTOR_SIZE
+#define PAGE_SIZE SFLASH_PAGE_SIZE
+#define PAGES (SECTOR_SIZE / PAGE_SIZE)
+#define FLASH_BLOCK_SIZE SFLASH_BLOCK_SIZE
+#define INVALID_ADDR 0xFFFFFFFF
+
+namespace cache {
+    // ====== PRIVATE ====== //
+    typedef struct line_t {
+        uint8_t  data[SECTOR_SIZE] __attribute__((aligned(4)));
+        uint32_t addr;  // Of the sector, INVALID_ADDR if the line is free
+        uint32_t used;    // Value of clock when it was last written
+        uint8_t  written; // Bit per block that was written since it was loaded
+        bool     dirty;   // Differs from the flash
+    } line_t;
+
+    Adafruit_SPIFlash* flash = nullptr;
+
+    static_assert(FLASH_CACHE_SECTORS >= 2, "One line has to be left while the other is borrowed");
+
+    line_t   lines[FLASH_CACHE_SECTORS];
+    line_t*  borrowed = nullptr;
+    uint32_t clock    = 0;
+
+    // Range of protect()
+    uint32_t protect_start = 0;
+    uint32_t protect_end   = 0;
+
+    stats_t stats;
+
+    class device_t : public FsBlockDeviceInterface {
+        public:
+            bool isBusy() {
+                return false;
+            }
+
+            uint32_t sectorCount() {
+                return flash->size() / BLOCK_SIZE;
+            }
+
+            bool syncDevice() {
+                return sync();
+            }
+
+            bool readSector(uint32_t sector, uint8_t* dst) {
+                return read(sector, dst, 1);
+            }
+
+            bool readSectors(uint32_t sector, uint8_t* dst, size_t ns) {
+                return read(sector, dst, ns);
+            }
+
+            bool writeSector(uint32_t sector, const uint8_t* src) {
+                return write(sector, src, 1);
+            }
+
+            bool writeSectors(uint32_t sector, const uint8_t* src, size_t ns) {
+                return write(sector, src, ns);
+            }
+    };
+
+    device_t block_device;
+
+    line_t* find(uint32_t addr) {
+        for (size_t i = 0; i < FLASH_CACHE_SECTORS; ++i) {
+            if (lines[i].addr == addr) return &lines[i];
+        }
+
+        return nullptr;
+    }
+
+    // Dirty line that can't be written back, because its sector is protected
+    bool held(const line_t* line) {
+        return line->dirty && (line->addr < protect_end) && (line->addr + SECTOR_SIZE > protect_start);
+    }
+
+    bool is_erased(const uint8_t* data) {
+        for (size_t i = 0; i < PAGE_SIZE; ++i) {
+            if (data[i] != 0xFF) return false;
+        }
+
+        return true;
+    }
+
+    // Whether the flash from addr to addr + len is erased already
+    bool is_blank(uint32_t addr, uint32_t len) {
+        uint8_t page[PAGE_SIZE] __attribute__((aligned(4)));
+
+        for (uint32_t i = 0; i < len; i += PAGE_SIZE) {
+            flash->readBuffer(addr + i, page, PAGE_SIZE);
+            if (!is_erased(page)) return false;
+        }
+
+        return true;
+    }
+
+    bool program(const line_t* line, size_t page) {
+        size_t offset = page * PAGE_SIZE;
+
+        return flash->writeBuffer(line->addr + offset, &line->data[offset], PAGE_SIZE) == PAGE_SIZE;
+    }
+
+    // Programming can only clear bits, so the sector is only erased if a bit has to go from 0 to 1.
+    // Pages that didn't change (or are blank after the erase) aren't programmed.
+    bool write_back(line_t* line) {
+        if (!line->dirty) return true;
+        if (held(line)) return false;
+
+        uint32_t start_time = micros();
+        uint8_t  stored[PAGE_SIZE] __attribute__((aligned(4)));
+        uint16_t changed     = 0; // Bit per page
+        bool     needs_erase = false;
+        bool     ok          = true;
+
+        for (size_t page = 0; page < PAGES; ++page) {
+            const uint8_t* data = &line->data[page * PAGE_SIZE];
+
+            flash->readBuffer(line->addr + page * PAGE_SIZE, stored, PAGE_SIZE);
+
+            if (memcmp(stored, data, PAGE_SIZE) == 0) continue;
+
+            changed |= 1 << page;
+
+            for (size_t i = 0; i < PAGE_SIZE && !needs_erase; ++i) {
+                needs_erase = (stored[i] & data[i]) != data[i];
+            }
+        }
+
+        if (!changed) {
+            ++stats.unchanged;
+        } else if (!needs_erase) {
+            for (size_t page = 0; page < PAGES && ok; ++page) {
+                if (changed & (1 << page)) ok = program(line, page);
+            }
+        } else {
+            ok = flash->eraseSector(line->addr / SECTOR_SIZE);
+            ++stats.erases;
+
+            for (size_t page = 0; page < PAGES && ok; ++page) {
+                if (!is_erased(&line->data[page * PAGE_SIZE])) ok = program(line, page);
+            }
+        }
+
+        // Stays dirty, so it isn't lost (or evicted) if the flash failed
+        if (ok) line->dirty = false;
+        else ++stats.failures;
+
+        ++stats.write_backs;
+        stats.sync_time += micros() - start_time;
+
+        return ok;
+    }
+
+    // Whether line should be evicted before other
+    bool older(const line_t* line, const line_t* other) {
+        // Sectors that the host rewrote completely are usually file data, streamed once.
+        // They go first, so FAT and directory sectors (written a few blocks at a time) stay.
+        bool full       = line->written == 0xFF;
+        bool other_full = other->written == 0xFF;
+
+        if (full != other_full) return full;
+
+        return line->used < other->used;
+    }
+
+    // Free line, or the one that is least likely to be written again (after writing it back)
+    line_t* evict() {
+        line_t* line = nullptr;
+
+        for (size_t i = 0; i < FLASH_CACHE_SECTORS; ++i) {
+            if (&lines[i] == borrowed) continue;
+            if (lines[i].addr == INVALID_ADDR) return &lines[i];
+            if (held(&lines[i])) continue;
+            if (!line || older(&lines[i], line)) line = &lines[i];
+        }
+
+        if (!line || !write_back(line)) return nullptr;
+
+        return line;
+    }
+
+    // Line for the sector at addr, evicts one if there is no free line.
+    // If the whole sector is overwritten anyway, it isn't loaded from flash.
+    line_t* get(uint32_t addr, bool load) {
+        line_t* line = find(addr);
+
+        if (line) {
+            ++stats.hits;
+            return line;
+        }
+
+        ++stats.misses;
+
+        line = evict();
+        if (!line) return nullptr;
+
+        line->addr    = addr;
+        line->written = 0;
+        line->dirty   = false;
+
+        if (load) flash->readBuffer(addr, line->data, SECTOR_SIZE);
+
+        return line;
+    }
+
+    // ====== PUBLIC ====== //
+    void begin(Adafruit_SPIFlash* _flash) {
+        flash = _flash;
+        clear();
+    }
+
+    FsBlockDeviceInterface* device() {
+        return &block_device;
+    }
+
+    bool read(uint32_t block, uint8_t* dst, size_t count) {
+        stats.reads += count;
+
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t addr      = (block + i) * BLOCK_SIZE;
+            line_t*  line      = find(addr & ~(SECTOR_SIZE - 1));
+            uint8_t* block_dst = dst + (i * BLOCK_SIZE);
+
+            if (line) {
+                memcpy(block_dst, &line->data[addr % SECTOR_SIZE], BLOCK_SIZE);
+            } else if (flash->readBuffer(addr, block_dst, BLOCK_SIZE) != BLOCK_SIZE) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool write(uint32_t block, const uint8_t* src, size_t count) {
+        uint32_t start_time = micros();
+        uint32_t addr       = block * BLOCK_SIZE;
+        uint32_t end        = addr + (count * BLOCK_SIZE);
+
+        stats.writes += count;
+
+        while (addr < end) {
+            uint32_t sector = addr & ~(SECTOR_SIZE - 1);
+            uint32_t offset = addr - sector;
+            uint32_t len    = SECTOR_SIZE - offset;
+
+            if (len > end - addr) len = end - addr;
+
+            line_t* line = get(sector, len < SECTOR_SIZE);
+
+            if (!line) return false;
+
+            memcpy(&line->data[offset], src, len);
+            line->written |= ((1 << (len / BLOCK_SIZE)) - 1) << (offset / BLOCK_SIZE);
+            line->dirty    = true;
+            line->used     = ++clock;
+
+            src  += len;
+            addr += len;
+        }
+
+        stats.write_time += micros() - start_time;
+
+        return true;
+    }
+
+    bool erase(uint32_t block, size_t count) {
+        uint32_t start_time = micros();
+        uint32_t addr       = block * BLOCK_SIZE;
+        uint32_t end        = addr + (count * BLOCK_SIZE);
+        bool     ok         = true;
+
+        if ((addr % SECTOR_SIZE) || (end % SECTOR_SIZE)) return false;
+
+        // Whatever is cached there would be written back over it
+        for (size_t i = 0; i < FLASH_CACHE_SECTORS; ++i) {
+            if ((lines[i].addr >= addr) && (lines[i].addr < end)) {
+                lines[i].addr  = INVALID_ADDR;
+                lines[i].dirty = false;
+            }
+        }
+
+        while (ok && (addr < end)) {
+            if ((addr % FLASH_BLOCK_SIZE == 0) && (end - addr >= FLASH_BLOCK_SIZE)) {
+                if (!is_blank(addr, FLASH_BLOCK_SIZE)) {
+                    ok = flash->eraseBlock(addr / FLASH_BLOCK_SIZE);
+                    ++stats.erases;
+                }
+                addr += FLASH_BLOCK_SIZE;
+            } else {
+                if (!is_blank(addr, SECTOR_SIZE)) {
+                    ok = flash->eraseSector(addr / SECTOR_SIZE);
+                    ++stats.erases;
+                }
+                addr += SECTOR_SIZE;
+            }
+        }
+
+        stats.sync_time += micros() - start_time;
+
+        return ok;
+    }
+
+    bool syncNext(bool* ok) {
+        line_t* line = nullptr;
+
+        for (size_t i = 0; i < FLASH_CACHE_SECTORS; ++i) {
+            if (!lines[i].dirty || held(&lines[i])) continue;
+            if (!line || (lines[i].used < line->used)) line = &lines[i];
+        }
+
+        *ok = true;
+
+        if (!line) return false;
+
+        *ok = write_back(line);
+        return true;
+    }
+
+    bool sync() {
+        bool ok = true;
+
+        for (size_t i = 0; i < FLASH_CACHE_SECTORS; ++i) {
+            if (!write_back(&lines[i])) ok = false;
+        }
+
+        return ok;
+    }
+
+    void protect(uint32_t addr, uint32_t len) {
+        protect_start = addr;
+        protect_end   = addr + len;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < FLASH_CACHE_SECTORS; ++i) {
+            lines[i].addr    = INVALID_ADDR;
+            lines[i].used    = 0;
+            lines[i].written = 0;
+            lines[i].dirty   = false;
+        }
+    }
+
+    uint8_t* borrow() {
+        if (borrowed) return nullptr;
+
+        borrowed = evict();
+        if (!borrowed) return nullptr;
+
+        borrowed->addr = INVALID_ADDR;
+
+        return borrowed->data;
+    }
+
+    void giveBack() {
+        borrowed = nullptr;
+    }
+
+    const stats_t& getStats() {
+        return stats;
+    }
+
+    void resetStats() {
+        memset(&stats, 0, sizeof(stats));
+    }
+
+    void print() {
+        debuglnF("[ = Flash Cache =]");
+
+        debugF("Blocks read/written: ");
+        debug(stats.reads);
+        debugF("/");
+        debugln(stats.writes);
+
+        debugF("Sector hits/misses: ");
+        debug(stats.hits);
+        debugF("/");
+        debugln(stats.misses);
+
+        debugF("Sectors written back/unchanged: ");
+        debug(stats.write_backs);
+        debugF("/");
+        debugln(stats.unchanged);
+
+        debugF("Erases: ");
+        debugln(stats.erases);
+
+        debugF("Failed write backs: ");
+        debugln(stats.failures);
+
+        debugF("Write time: ");
+        debug(stats.write_time);
+        debuglnF(" us");
+
+        debugF("Write back time: ");
+        debug(stats.sync_time);
+        debuglnF(" us");
+
+        debugln();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint32_t
+
+class Adafruit_SPIFlash;
+class FsBlockDeviceInterface;
+
+// Write-back cache of FLASH_CACHE_SECTORS flash sectors (4 KB each) in front of the USB drive and the file system.
+// Written sectors stay in RAM until they are evicted (least recently used first) or synced,
+// so the host updating FAT, directory and data in turns doesn't erase the same sectors over and over.
+// A sector is only erased when its new data can't be programmed over the old (see write_back()).
+namespace cache {
+    typedef struct stats_t {
+        uint32_t reads;       // Blocks (512 bytes) read
+        uint32_t writes;      // Blocks written
+        uint32_t hits;        // Sector writes that found the sector in the cache
+        uint32_t misses;      // Sector writes that had to load the sector first
+        uint32_t write_backs; // Dirty sectors that were written back
+        uint32_t unchanged;   // ...of which already had the same data in flash
+        uint32_t erases;      // Sector (or 64 KB block) erases
+        uint32_t failures;    // Write backs where erasing or programming failed
+        uint32_t write_time;  // us spent in write(), including evictions
+        uint32_t sync_time;   // us spent writing back sectors
+    } stats_t;
+
+    // flash has to be uncached (useCache = false)
+    void begin(Adafruit_SPIFlash* flash);
+
+    // Block device for FatFileSystem::begin()
+    FsBlockDeviceInterface* device();
+
+    bool read(uint32_t block, uint8_t* dst, size_t count);
+    bool write(uint32_t block, const uint8_t* src, size_t count);
+
+    // Erases count blocks (whole flash sectors) from block on, skipping what's erased already.
+    // Uses 64 KB block erases where it can.
+    bool erase(uint32_t block, size_t count);
+
+    // Writes back the least recently used dirty sector, returns false if there was none.
+    // ok is false if that failed, the sector stays dirty then.
+    bool syncNext(bool* ok);
+
+    // Writes back all dirty sectors, returns false if any of them failed (or is protected)
+    bool sync();
+
+    // Sectors from addr to addr + len aren't written back, until it's called again (len 0 for none).
+    // They are read directly from flash (see msc.cpp), so writes to them stay in the cache.
+    // write() fails if no other line is left for a new sector.
+    void protect(uint32_t addr, uint32_t len);
+
+    // Forgets all sectors without writing them back (i.e. after formatting)
+    void clear();
+
+    // Lends a sector buffer (SFLASH_SECTOR_SIZE bytes) as scratch memory, i.e. for formatting.
+    // The cache keeps working with one line less until it's given back.
+    // Returns nullptr if it's already borrowed.
+    uint8_t* borrow();
+    void giveBack();
+
+    const stats_t& getStats();
+    void resetStats(); // i.e. before timing a copy
+    void print();
+}
\ No newline at end of file
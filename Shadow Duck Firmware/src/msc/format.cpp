@@ -5,159 +5,185 @@
 #include "config.h"
 #include "debug.h"
 
-// This module is based on the Adafruit SPI Flash FatFs Format Example
-// https://github.com/adafruit/Adafruit_SPIFlash/tree/master/examples/SdFat_format
+#include <Arduino.h> // millis(), micros()
+#include <string.h>  // memset, memcpy
 
-#include <SPI.h>
 #include <SdFat.h>
-#include <Adafruit_SPIFlash.h>
 
-// Since SdFat doesn't fully support FAT12 such as format a new flash
-// We will use Elm Cham's fatfs f_mkfs() to format
-#include "ff.h"
-#include "diskio.h"
+#include "msc/cache.h"
+
+// Same layout that Elm-ChaN's f_mkfs(FM_FAT | FM_SFD) used to create:
+// boot sector, one FAT, 512 root directory entries, then the data area starting at a flash sector
+#define BLOCK_SIZE 512
+#define DIR_ENTRY_SIZE 32
+#define ROOT_ENTRIES 512
+#define ROOT_SECTORS (ROOT_ENTRIES * DIR_ENTRY_SIZE / BLOCK_SIZE)
+#define DATA_ALIGN 8 // Blocks per flash sector
+#define MAX_FAT12 0xFF5
 
 namespace format {
     // ========== PRIVATE ========= //
-#if defined(ARDUINO_ARCH_RP2040)
-    // RP2040 use same flash device that store code for file system. Therefore we
-    // only need to specify start address and size (no need SPI or SS)
-    // By default (start=0, size=0), values that match file system setting in
-    // 'Tools->Flash Size' menu selection will be used.
-    Adafruit_FlashTransport_RP2040 flashTransport;
-#else // if defined(ARDUINO_ARCH_RP2040)
-    Adafruit_FlashTransport_SPI flashTransport(EXTERNAL_FLASH_USE_CS, EXTERNAL_FLASH_USE_SPI);
-#endif // if defined(ARDUINO_ARCH_RP2040)
-
-    Adafruit_SPIFlash flash(&flashTransport);
-
-    // file system object from SdFat
-    FatFileSystem fatfs;
-
-    // Elm Cham's fatfs objects
-    FATFS   elmchamFatfs;
-    uint8_t workbuf[4096]; // Working buffer for f_fdisk function.
-
-    // --------------------------------------------------------------------+
-    // fatfs diskio
-    // --------------------------------------------------------------------+
-    extern "C"
-    {
-        DSTATUS disk_status(BYTE pdrv) {
-            (void)pdrv;
-            return 0;
-        }
+    typedef struct layout_t {
+        uint32_t sectors;      // Of the volume
+        uint32_t cluster_size; // Sectors per cluster
+        uint32_t fat_size;     // Sectors
+        uint32_t root_start;   // First sector of the root directory
+        uint32_t data_start;   // First sector of cluster 2
+        uint32_t clusters;
+    } layout_t;
+
+    void put16(uint8_t* dst, uint16_t value) {
+        dst[0] = value;
+        dst[1] = value >> 8;
+    }
 
-        DSTATUS disk_initialize(BYTE pdrv) {
-            (void)pdrv;
-            return 0;
-        }
+    void put32(uint8_t* dst, uint32_t value) {
+        put16(dst, value);
+        put16(&dst[2], value >> 16);
+    }
+
+    bool plan(layout_t& l, uint32_t sectors) {
+        l.sectors      = sectors;
+        l.cluster_size = 1;
+
+        while (sectors / l.cluster_size > MAX_FAT12) l.cluster_size *= 2;
+        if (l.cluster_size > 128) return false;
+
+        // 1.5 bytes per cluster, plus the 2 reserved entries
+        l.fat_size   = ((sectors / l.cluster_size * 3 + 1) / 2 + 3 + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        l.root_start = 1 + l.fat_size;
+        l.data_start = l.root_start + ROOT_SECTORS;
+
+        // Grow the FAT, so that no cluster shares a flash sector with the metadata
+        uint32_t pad = (DATA_ALIGN - (l.data_start % DATA_ALIGN)) % DATA_ALIGN;
+
+        l.fat_size   += pad;
+        l.root_start += pad;
+        l.data_start += pad;
+
+        l.clusters = (sectors - l.data_start) / l.cluster_size;
+
+        return l.clusters >= 16 && l.clusters <= MAX_FAT12;
+    }
+
+    // Upper case, padded with spaces, characters FAT doesn't allow replaced
+    void make_label(char* label, const char* drive_name) {
+        memset(label, ' ', 11);
+
+        for (size_t i = 0; i < 11 && drive_name && drive_name[i]; ++i) {
+            char c = drive_name[i];
 
-        DRESULT disk_read(BYTE  pdrv,   /* Physical drive nmuber to identify the drive */
-                          BYTE* buff,   /* Data buffer to store read data */
-                          DWORD sector, /* Start sector in LBA */
-                          UINT  count   /* Number of sectors to read */
-                          ) {
-            (void)pdrv;
-            return flash.readBlocks(sector, buff, count) ? RES_OK : RES_ERROR;
+            if ((c >= 'a') && (c <= 'z')) c -= 'a' - 'A';
+            if ((c < ' ') || strchr("\"*+,./:;<=>?[\\]|", c)) c = '_';
+
+            label[i] = c;
         }
 
-        DRESULT disk_write(BYTE        pdrv,   /* Physical drive nmuber to identify the drive */
-                           const BYTE* buff,   /* Data to be written */
-                           DWORD       sector, /* Start sector in LBA */
-                           UINT        count   /* Number of sectors to write */
-                           ) {
-            (void)pdrv;
-            return flash.writeBlocks(sector, buff, count) ? RES_OK : RES_ERROR;
+        if (label[0] == ' ') memcpy(label, "NO NAME    ", 11);
+    }
+
+    void make_boot_sector(uint8_t* s, const layout_t& l, const char* label) {
+        memcpy(&s[0], "\xEB\xFE\x90" "MSDOS5.0", 11); // Jump code, OEM name
+        put16(&s[11], BLOCK_SIZE);
+        s[13] = l.cluster_size;
+        put16(&s[14], 1);                           // Reserved sectors (this one)
+        s[16] = 1;                                  // FATs
+        put16(&s[17], ROOT_ENTRIES);
+        s[21] = 0xF8;                               // Media descriptor (fixed disk)
+        put16(&s[22], l.fat_size);
+        put16(&s[24], 63);                          // Sectors per track
+        put16(&s[26], 255);                         // Heads
+        s[36] = 0x80;                               // Drive number
+        s[38] = 0x29;                               // Extended boot signature
+        put32(&s[39], micros());                    // Volume serial number
+        memcpy(&s[43], label, 11);
+        memcpy(&s[54], "FAT12   ", 8);
+        put16(&s[510], 0xAA55);
+
+        // Sector count, 32 bit field if it doesn't fit 16
+        if (l.sectors < 0x10000) {
+            put16(&s[19], l.sectors);
+        } else {
+            put32(&s[32], l.sectors);
         }
+    }
 
-        DRESULT disk_ioctl(BYTE  pdrv, /* Physical drive nmuber (0..) */
-                           BYTE  cmd,  /* Control code */
-                           void* buff  /* Buffer to send/receive control data */
-                           ) {
-            (void)pdrv;
+    // Boot sector, FAT and root directory, using scratch to write as many sectors at once as fit
+    bool write_metadata(const layout_t& l, const char* label, uint8_t* scratch, size_t scratch_size) {
+        uint32_t per_write = scratch_size / BLOCK_SIZE;
 
-            switch (cmd) {
-                case CTRL_SYNC:
-                    flash.syncBlocks();
-                    return RES_OK;
+        for (uint32_t first = 0; first < l.data_start; first += per_write) {
+            uint32_t n = l.data_start - first;
 
-                case GET_SECTOR_COUNT:
-                    *((DWORD*)buff) = flash.size()/512;
-                    return RES_OK;
+            if (n > per_write) n = per_write;
 
-                case GET_SECTOR_SIZE:
-                    *((WORD*)buff) = 512;
-                    return RES_OK;
+            memset(scratch, 0, n * BLOCK_SIZE);
 
-                case GET_BLOCK_SIZE:
-                    *((DWORD*)buff) = 8; // erase block size in units of sector size
-                    return RES_OK;
+            for (uint32_t i = 0; i < n; ++i) {
+                uint8_t* s = &scratch[i * BLOCK_SIZE];
 
-                default:
-                    return RES_PARERR;
+                if (first + i == 0) {
+                    make_boot_sector(s, l, label);
+                } else if (first + i == 1) {
+                    // Entry 0 (media descriptor) and 1 (end of chain)
+                    s[0] = 0xF8;
+                    s[1] = 0xFF;
+                    s[2] = 0xFF;
+                } else if (first + i == l.root_start) {
+                    // Volume label entry
+                    memcpy(s, label, 11);
+                    s[11] = 0x08;
+                }
             }
+
+            if (!cache::write(first, scratch, n)) return false;
         }
+
+        return true;
     }
 
     // ========== PUBLIC ========= //
-    bool start(const char* drive_name) {
+    bool start(uint8_t* scratch, size_t scratch_size, const char* drive_name) {
         debugln("Starting format...");
 
-        // Initialize flash library and check its chip ID.
-        if (!flash.begin()) {
-            debugln("Error, failed to initialize flash chip!");
-            return false;
-        }
-
-        debug("Flash chip JEDEC ID: 0x");
-        debugln(flash.getJEDECID(), HEX);
+        uint32_t start_time = millis();
+        layout_t layout;
+        char     label[11];
 
-        // Call fatfs begin and passed flash object to initialize file system
-        debugln("Creating and formatting FAT filesystem (this takes ~60 seconds)...");
-
-        // Make filesystem.
-        FRESULT r = f_mkfs("", FM_FAT | FM_SFD, 0, workbuf, sizeof(workbuf));
-        if (r != FR_OK) {
-            debug("Error, f_mkfs failed with error code: ");
-            debugln(r, DEC);
+        if (!scratch || (scratch_size < BLOCK_SIZE)) {
+            debugln("Error, no memory to format!");
             return false;
         }
 
-        // Mount to set disk label
-        r = f_mount(&elmchamFatfs, "0:", 1);
-        if (r != FR_OK) {
-            debug("Error, f_mount failed with error code: ");
-            debugln(r, DEC);
+        if (!plan(layout, cache::device()->sectorCount())) {
+            debugln("Error, drive size doesn't fit FAT12!");
             return false;
         }
 
-        // Setting label
-        debug("Setting disk label to:");
-        debugln(drive_name);
-        r = f_setlabel(drive_name);
-        if (r != FR_OK) {
-            debug("Error, f_setlabel failed with error code: ");
-            debugln(r, DEC);
-            return false;
-        }
+        make_label(label, drive_name);
 
-        // unmount
-        f_unmount("0:");
+        debug("Creating FAT12 filesystem ");
+        debug(layout.clusters);
+        debug(" clusters of ");
+        debug(layout.cluster_size * BLOCK_SIZE);
+        debugln(" bytes");
 
-        // sync to make sure all data is written to flash
-        flash.syncBlocks();
+        // Leaves the data area blank, so files copied later only have to be programmed
+        uint32_t data_size = (layout.sectors - layout.data_start) / DATA_ALIGN * DATA_ALIGN;
 
-        debugln("Formatted flash!");
+        if (!cache::erase(layout.data_start, data_size)) {
+            debugln("Error, failed to erase flash!");
+            return false;
+        }
 
-        // Check new filesystem
-        if (!fatfs.begin(&flash)) {
-            debugln("Error, failed to mount newly formatted filesystem!");
+        if (!write_metadata(layout, label, scratch, scratch_size) || !cache::sync()) {
+            debugln("Error, failed to write filesystem!");
             return false;
         }
 
-        // Done!
-        debugln("Flash chip successfully formatted with new empty filesystem!");
+        debug("Formatted flash in ");
+        debug(millis() - start_time);
+        debugln(" ms");
         return true;
     }
 }
\ No newline at end of file
@@ -2,6 +2,12 @@
 
 #pragma once
 
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
 namespace format {
-    bool start(const char* drive_name = "ShadowDuck");
+    // Creates an empty FAT12 file system on the drive (see msc/cache.h), using scratch as working memory.
+    // Only the boot sector, FAT and root directory are written, the data area is erased where it isn't blank yet.
+    // Mounting it is up to the caller (see msc::format()).
+    bool start(uint8_t* scratch, size_t scratch_size, const char* drive_name = "ShadowDuck");
 }
\ No newline at end of file
@@ -13,6 +13,18 @@
 #include <Adafruit_TinyUSB.h>
 
 #include "format.h"
+#include "cache.h"
+#include "paths.h"
+#include "events/events.h"
+#include "preferences/snapshot.h"
+#include "tasks/tasks.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <pico/mutex.h>
+
+// Start of the file system in the memory mapped (XIP) flash, set by the linker
+extern uint8_t _FS_start;
+#endif // if defined(ARDUINO_ARCH_RP2040)
 
 namespace msc {
     // ===== PRIVATE ===== //
@@ -22,6 +34,7 @@ namespace msc {
     } file_element_t;
 
     std::stack<file_element_t> file_stack;
+    bool on_stack = false; // The open file has an element on file_stack
 
 #if defined(ARDUINO_ARCH_RP2040)
     // RP2040 use same flash device that store code for file system. Therefore we
@@ -33,22 +46,180 @@ namespace msc {
     Adafruit_FlashTransport_SPI flashTransport(EXTERNAL_FLASH_USE_CS, EXTERNAL_FLASH_USE_SPI);
 #endif // if defined(ARDUINO_ARCH_RP2040)
 
-    Adafruit_SPIFlash flash(&flashTransport);
+    // Without the library's single sector cache, writes go through cache.h
+    Adafruit_SPIFlash flash(&flashTransport, false);
     Adafruit_USBD_MSC usb_msc;
 
     FatFileSystem fatfs;
     FatFile file;
 
+#if defined(ARDUINO_ARCH_RP2040)
+    // Scripts are read on core1 (see attack/prefetch.h) while core0 serves the USB drive
+    auto_init_mutex(flash_mutex);
+#endif // if defined(ARDUINO_ARCH_RP2040)
+
     bool fs_changed = false; // Flag which goes to true when PC write to flash
     bool in_line    = false;
 
+    int  sync_task   = -1;
+    bool sync_paused = false; // While an attack runs
+
+    // Read-ahead buffer of the open file, refilled with one read() per block
+    uint8_t read_cache[READ_CACHE] __attribute__((aligned(4)));
+    size_t  cache_pos = 0; // Next unread byte
+    size_t  cache_len = 0; // Valid bytes
+
+    void cache_clear() {
+        cache_pos = 0;
+        cache_len = 0;
+    }
+
+    bool cache_fill() {
+        if (!file.isOpen()) return false;
+
+        // Keep file reads sector aligned, so SdFat can read directly into our buffer
+        size_t len = READ_CACHE - (file.curPosition() % 512);
+        int    res = file.read(read_cache, len);
+
+        cache_pos = 0;
+        cache_len = res > 0 ? res : 0;
+
+        return cache_len > 0;
+    }
+
+    bool cache_eof() {
+        return cache_pos == cache_len && file.available32() == 0;
+    }
+
+    // Writes back the cached sectors, one at a time,
+    // so the USB interrupt (which uses the cache too) gets through in between.
+    // Returns false if the flash failed, the sectors that are left stay in the cache.
+    bool sync() {
+        bool more = true;
+        bool ok   = true;
+
+        while (more && ok) {
+            noInterrupts();
+            lock();
+            more = cache::syncNext(&ok);
+            unlock();
+            interrupts();
+        }
+
+        if (!ok) debugln("Error, failed to write flash!");
+
+        return ok;
+    }
+
+    // Keeps the cache from writing back the sectors of a mapped file (see cache::protect()).
+    // Lines compiled from it refer to its text, so it lasts until the file is closed.
+    void protect_file(uint32_t addr, uint32_t len) {
+        noInterrupts();
+        lock();
+        cache::protect(addr, len);
+        unlock();
+        interrupts();
+
+        // Writes that were held back can go now
+        if ((len == 0) && !sync_paused) tasks::schedule(sync_task, FLASH_SYNC_DELAY);
+    }
+
+    // The open file, if its clusters are in one piece in memory mapped flash
+    const char* map_base = nullptr;
+    uint32_t    map_size = 0;
+    uint32_t    map_pos  = 0; // Next unread byte
+
+    void unmap_file() {
+        map_base = nullptr;
+        map_size = 0;
+        map_pos  = 0;
+    }
+
+    void map_file() {
+        unmap_file();
+
+#if defined(ARDUINO_ARCH_RP2040)
+        uint32_t first_sector;
+        uint32_t last_sector;
+
+        // Walks the cluster chain once, fails for fragmented (and empty) files
+        if (!file.contiguousRange(&first_sector, &last_sector)) return;
+        if ((last_sector + 1) * 512 > flash.size()) return;
+
+        // Pending writes must reach the flash before we read it directly
+        if (!sync()) return;
+
+        protect_file(first_sector * 512, (last_sector + 1 - first_sector) * 512);
+
+        map_base = (const char*)&_FS_start + first_sector * 512;
+        map_size = file.fileSize();
+        map_pos  = file.curPosition();
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+
+    // Opens path into file, through its root directory entry if it's cached (see paths.h)
+    bool open_file(const char* path) {
+        const paths::entry_t* e = paths::find(path);
+
+        if (e && !e->found) return false;
+
+        if (e && e->in_root) {
+            FatFile root;
+
+            // Make sure it's still the same file, in case a change was missed
+            if (root.openRoot(&fatfs) && file.open(&root, e->dir_index, O_RDONLY) &&
+                (file.firstSector() == e->first_sector) && (file.fileSize() == e->size)) return true;
+
+            if (file.isOpen()) file.close();
+        }
+
+        if (!file.open(path)) {
+            paths::rememberMissing(path);
+            return false;
+        }
+
+        paths::remember(path, file.firstSector(), file.fileSize(), file.dirIndex(), file.attrib());
+        return true;
+    }
+
+    // Index of the first '\n' or '\r' in str, or len if there is none.
+    // Tests 4 bytes at a time once str is word aligned.
+    size_t find_linebreak(const uint8_t* str, size_t len) {
+        size_t i = 0;
+
+        // Bytes until the next word boundary
+        while (i < len && ((uintptr_t)&str[i] & 3)) {
+            if ((str[i] == '\n') || (str[i] == '\r')) return i;
+            ++i;
+        }
+
+        // A byte of x is zero <=> the word has a high bit set in (x - 0x01..) & ~x & 0x80..
+        for (; i + 4 <= len; i += 4) {
+            uint32_t word = *(const uint32_t*)&str[i];
+            uint32_t lf   = word ^ 0x0A0A0A0A;
+            uint32_t cr   = word ^ 0x0D0D0D0D;
+
+            if (((lf - 0x01010101) & ~lf & 0x80808080) ||
+                ((cr - 0x01010101) & ~cr & 0x80808080)) break;
+        }
+
+        // Remaining bytes (or the word containing the linebreak)
+        for (; i < len; ++i) {
+            if ((str[i] == '\n') || (str[i] == '\r')) return i;
+        }
+
+        return len;
+    }
+
     // Callback invoked when received READ10 command.
     // Copy disk's data to buffer (up to bufsize) and
     // return number of copied bytes (must be multiple of block size)
     int32_t read_cb(uint32_t lba, void* buffer, uint32_t bufsize) {
-        // Note: SPIFLash Block API: readBlocks/writeBlocks/syncBlocks
-        // already include 4K sector caching internally. We don't need to cache it, yahhhh!!
-        return flash.readBlocks(lba, (uint8_t*)buffer, bufsize / 512) ? bufsize : -1;
+        lock();
+        bool ok = cache::read(lba, (uint8_t*)buffer, bufsize / 512);
+        unlock();
+
+        return ok ? bufsize : -1;
     }
 
     // Callback invoked when received WRITE10 command.
@@ -57,25 +228,48 @@ namespace msc {
     int32_t write_cb(uint32_t lba, uint8_t* buffer, uint32_t bufsize) {
         digitalWrite(LED_BUILTIN, HIGH);
 
-        // Note: SPIFLash Block API: readBlocks/writeBlocks/syncBlocks
-        // already include 4K sector caching internally. We don't need to cache it, yahhhh!!
-        return flash.writeBlocks(lba, buffer, bufsize / 512) ? bufsize : -1;
+        lock();
+        bool ok = cache::write(lba, buffer, bufsize / 512);
+        unlock();
+
+        // Written back once the host paused for FLASH_SYNC_DELAY
+        tasks::schedule(sync_task, FLASH_SYNC_DELAY);
+
+        return ok ? bufsize : -1;
     }
 
     // Callback invoked when WRITE10 command is completed (status received and accepted by host).
-    // used to flush any pending cache.
+    // The host writes a file with many of them (FAT, directory, data...),
+    // so the cache is only written back when it's idle (see sync_task).
     void flush_cb(void) {
-        // sync with flash
-        flash.syncBlocks();
+        lock();
 
         // clear file system's cache to force refresh
         fatfs.cacheClear();
 
+        unlock();
+
         fs_changed = true;
+        paths::clear();
+        events::post(events::EVENT_DRIVE);
 
         digitalWrite(LED_BUILTIN, LOW);
     }
 
+    // Callback invoked when the host ejects the drive, nothing may stay in RAM after that
+    bool start_stop_cb(uint8_t power_condition, bool start, bool load_eject) {
+        bool ok = true;
+
+        if (load_eject && !start) {
+            lock();
+            ok = cache::sync();
+            unlock();
+        }
+
+        // The host reports the eject as failed
+        return ok;
+    }
+
     // ===== PUBLIC ===== //
     bool init() {
         if (!flash.begin()) {
@@ -83,21 +277,53 @@ namespace msc {
             return false;
         }
 
-        // Try formatting the drive if initialization failed
-        if (!fatfs.begin(&flash)) {
-            format();
+        cache::begin(&flash);
+        sync_task = tasks::add("flash", [] {
+            // resumeSync() schedules it again
+            if (sync_paused) return;
 
-            if (!fatfs.begin(&flash)) {
-                debugln("Couldn't mount flash!");
-                return false;
-            }
+            // Try again later, the sectors stay in the cache
+            if (!sync()) tasks::schedule(sync_task, FLASH_SYNC_DELAY);
+        }, 0);
+
+        // Try formatting the drive if initialization failed (which mounts it again)
+        if (!fatfs.begin(cache::device()) && !format()) {
+            debugln("Couldn't mount flash!");
+            return false;
         }
 
         return true;
     }
 
     bool format(const char* drive_name) {
-        return format::start(drive_name);
+        // The host shouldn't touch the drive while it's rebuilt
+        usb_msc.setUnitReady(false);
+
+        if (file.isOpen()) file.close();
+        unmap_file();
+        protect_file(0, 0);
+        cache_clear();
+
+        // Working memory is one of the cache's sectors
+        uint8_t* scratch = cache::borrow();
+        bool     ok      = format::start(scratch, SFLASH_SECTOR_SIZE, drive_name);
+
+        cache::giveBack();
+
+        paths::clear();
+
+        // The settings of the old preferences.json are gone
+        snapshot::invalidate();
+
+        // Mount the new file system
+        if (ok && !fatfs.begin(cache::device())) {
+            debugln("Error, failed to mount newly formatted filesystem!");
+            ok = false;
+        }
+
+        usb_msc.setUnitReady(true);
+
+        return ok;
     }
 
     void print() {
@@ -126,6 +352,7 @@ namespace msc {
 
     void enableDrive() {
         usb_msc.setReadWriteCallback(read_cb, write_cb, flush_cb);
+        usb_msc.setStartStopCallback(start_stop_cb);
         usb_msc.setCapacity(flash.size() / 512, 512);
         usb_msc.setUnitReady(true);
         usb_msc.begin();
@@ -139,7 +366,21 @@ namespace msc {
     }
 
     bool exists(const char* filename) {
-        return fatfs.exists(filename);
+        const paths::entry_t* e = paths::find(filename);
+
+        if (e) return e->found;
+
+        FatFile f;
+
+        if (!f.open(filename, O_RDONLY)) {
+            paths::rememberMissing(filename);
+            return false;
+        }
+
+        paths::remember(filename, f.firstSector(), f.fileSize(), f.dirIndex(), f.attrib());
+        f.close();
+
+        return true;
     }
 
     bool open(const char* path, bool add_to_stack) {
@@ -151,11 +392,12 @@ namespace msc {
 
         // If the stack isn't empty, save the current position
         if (add_to_stack && !file_stack.empty()) {
-            file_stack.top().pos = file.curPosition();
+            file_stack.top().pos = getPosition();
         }
 
         // If a file is already open, close it
         if (file.isOpen()) file.close();
+        cache_clear();
 
         // Create a new file element and push it to the stack
         if (add_to_stack) {
@@ -165,8 +407,13 @@ namespace msc {
             file_stack.push(file_element);
         }
 
+        on_stack = add_to_stack;
+
         // Open file and return whether it was successful
-        return file.open(path);
+        if (!open_file(path)) return false;
+
+        map_file();
+        return true;
     }
 
     bool openNextFile() {
@@ -186,8 +433,12 @@ namespace msc {
         // Get the next file from the stack
         file_element_t file_element = file_stack.top();
 
+        on_stack = true;
+
         // Open the file
-        if (file.open(file_element.path.c_str())) {
+        if (open_file(file_element.path.c_str())) {
+            map_file();
+
             // Seek to the saved position
             gotoPosition(file_element.pos);
             debugln("OK");
@@ -204,25 +455,53 @@ namespace msc {
         // Close current file and remove it from stack (it's not needed anymore)
         debug("Stack (before file close): ");
         debugln(file_stack.size());
-        debugln(file_stack.top().path.c_str());
+
+        // A file that was opened without adding it (i.e. preferences) leaves the stack as it is
+        if (on_stack) {
+            debugln(file_stack.top().path.c_str());
+            file_stack.pop();
+        }
+
+        on_stack = false;
 
         file.close();
-        file_stack.pop();
+        cache_clear();
+        unmap_file();
+        protect_file(0, 0);
 
         debug("Stack (after file close): ");
         debugln(file_stack.size());
     }
 
     uint32_t getPosition() {
-        return file.curPosition();
+        if (map_base) return map_pos;
+
+        // Bytes that were read ahead don't count
+        return file.curPosition() - (cache_len - cache_pos);
     }
 
     void gotoPosition(uint32_t pos) {
+        if (map_base) map_pos = pos < map_size ? pos : map_size;
+
+        cache_clear();
         file.seekSet(pos);
     }
 
     size_t read(char* buffer, size_t len) {
-        return file.read(buffer, len);
+        size_t read = cache_len - cache_pos;
+
+        if (read > len) read = len;
+
+        // Use up what is left in the cache first
+        memcpy(buffer, &read_cache[cache_pos], read);
+        cache_pos += read;
+
+        if (read < len) {
+            int res = file.read(&buffer[read], len - read);
+            if (res > 0) read += res;
+        }
+
+        return read;
     }
 
     size_t readLine(char* buffer, size_t len) {
@@ -230,24 +509,40 @@ namespace msc {
 
         // Read as long as the file has data and buffer is not full
         // -1 to compensate for a extra linebreak at the end of the file
-        while (file.isOpen() && file.available() > 0 && read < len-1) {
-            // Read character by character
-            char c = file.read();
+        while (file.isOpen() && read < len-1) {
+            if ((cache_pos == cache_len) && !cache_fill()) break;
+
+            size_t avail = cache_len - cache_pos;
+            size_t max   = len - 1 - read;
 
-            if (c == '\r') c = '\n';
+            if (avail < max) max = avail;
 
-            // Write into buffer
-            buffer[read] = c;
-            ++read;
+            // Copy everything up to the next linebreak at once
+            size_t n = find_linebreak(&read_cache[cache_pos], max);
+
+            memcpy(&buffer[read], &read_cache[cache_pos], n);
+            read      += n;
+            cache_pos += n;
+
+            // If linebreak found, skip it (and following empty lines)
+            if (n < max) {
+                buffer[read] = '\n';
+                ++read;
+                ++cache_pos;
+
+                while ((cache_pos < cache_len) || cache_fill()) {
+                    if (read_cache[cache_pos] != '\n') break;
+                    ++cache_pos;
+                }
 
-            // If linebreak found, break loop
-            if (c == '\n') {
-                while (file.peek() == '\n') file.read();
                 in_line = false;
-                break;
+                return read;
             }
+        }
+
+        if (read > 0) {
             // If reached end of the file, add linebreak as last character
-            else if (!file.available()) {
+            if (cache_eof()) {
                 buffer[read] = '\n';
                 in_line      = false;
                 ++read;
@@ -257,17 +552,71 @@ namespace msc {
         }
 
         return read;
+    }
+
+    size_t readLine(char* buffer, size_t len, const char** line) {
+        *line = buffer;
+
+        if (map_base && (map_pos < map_size)) {
+            const char* str = &map_base[map_pos];
+            size_t n        = find_linebreak((const uint8_t*)str, map_size - map_pos);
+
+            // The line stays where it is, including its linebreak
+            if (n < map_size - map_pos) {
+                *line    = str;
+                map_pos += n + 1;
+
+                // Skip following empty lines, like the buffered path does
+                while ((map_pos < map_size) && (map_base[map_pos] == '\n')) ++map_pos;
+
+                in_line = false;
+                return n + 1;
+            }
 
-        // return file.readBytesUntil('\n', buffer, len);
+            // The last line has no linebreak, which the parser needs.
+            // Continue with the buffered path from here.
+            uint32_t pos = map_pos;
+
+            unmap_file();
+            gotoPosition(pos);
+        }
+
+        if (map_base) return 0;
+
+        return readLine(buffer, len);
     }
 
     bool getInLine() {
         return in_line;
     }
 
+    void lock() {
+#if defined(ARDUINO_ARCH_RP2040)
+        mutex_enter_blocking(&flash_mutex);
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+
+    void unlock() {
+#if defined(ARDUINO_ARCH_RP2040)
+        mutex_exit(&flash_mutex);
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+
+    void pauseSync() {
+        sync_paused = true;
+    }
+
+    void resumeSync() {
+        sync_paused = false;
+        tasks::schedule(sync_task, FLASH_SYNC_DELAY);
+    }
+
     size_t write(const char* path, const char* buffer, size_t len) {
         FatFile wfile;
 
+        // Creates the file or changes its size
+        paths::clear();
+
         wfile.open(path, (O_RDWR | O_CREAT));
         if (!wfile.isOpen()) return 0;
 
@@ -24,7 +24,22 @@ namespace msc {
 
     size_t read(char* buffer, size_t len);
     size_t readLine(char* buffer, size_t len);
+
+    // Same as readLine(), but if the file can be read directly from flash (RP2040 XIP),
+    // line points to it instead of copying into buffer (and the line has no length limit)
+    size_t readLine(char* buffer, size_t len, const char** line);
     bool getInLine();
 
+    // Keeps the USB drive away from the flash while another core reads a file.
+    // The USB callbacks take it in an interrupt on core0, so other code on core0
+    // may only take it with interrupts disabled, or the callback waits for itself.
+    void lock();
+    void unlock();
+
+    // Writes of the USB drive stay in the cache until resumeSync() (unless it's full),
+    // so erasing the flash doesn't stall typing
+    void pauseSync();
+    void resumeSync();
+
     size_t write(const char* path, const char* buffer, size_t len);
 }
\ No newline at end of file
@@ -0,0 +1,119 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#include "msc/paths.h"
+
+#include "config.h"
+
+#include <stddef.h> // size_t
+#include <string.h> // strchr, strlen, memcpy
+
+namespace paths {
+    // ====== PRIVATE ====== //
+    entry_t entries[PATH_CACHE];
+    size_t  next_entry = 0; // Replaced next, round robin
+
+    volatile bool stale = false;
+
+    const char* skip_slashes(const char* path) {
+        while (*path == '/') ++path;
+        return path;
+    }
+
+    char to_lower(char c) {
+        return ((c >= 'A') && (c <= 'Z')) ? c + ('a' - 'A') : c;
+    }
+
+    // FNV-1a of the path, upper and lower case are the same in FAT
+    uint32_t hash(const char* path) {
+        uint32_t h = 2166136261;
+
+        for (; *path; ++path) h = (h ^ (uint8_t)to_lower(*path)) * 16777619;
+
+        return h ? h : 1;
+    }
+
+    // The hash only rules out most entries, the path decides
+    bool matches(const entry_t& e, uint32_t h, const char* path) {
+        if (e.hash != h) return false;
+
+        for (size_t i = 0; e.path[i] || path[i]; ++i) {
+            if (to_lower(e.path[i]) != to_lower(path[i])) return false;
+        }
+
+        return true;
+    }
+
+    void drop_if_stale() {
+        if (!stale) return;
+
+        stale = false;
+
+        for (size_t i = 0; i < PATH_CACHE; ++i) entries[i].hash = 0;
+    }
+
+    // nullptr if the path is too long to be cached
+    entry_t* add(const char* path) {
+        path = skip_slashes(path);
+
+        uint32_t h   = hash(path);
+        size_t   len = strlen(path);
+
+        drop_if_stale();
+
+        if (len >= PATH_CACHE_LEN) return nullptr;
+
+        // Update the entry if the path is known already
+        for (size_t i = 0; i < PATH_CACHE; ++i) {
+            if (matches(entries[i], h, path)) return &entries[i];
+        }
+
+        entry_t* e = &entries[next_entry];
+
+        next_entry = (next_entry + 1) % PATH_CACHE;
+        e->hash    = h;
+        memcpy(e->path, path, len + 1);
+
+        return e;
+    }
+
+    // ====== PUBLIC ====== //
+    const entry_t* find(const char* path) {
+        path = skip_slashes(path);
+
+        uint32_t h = hash(path);
+
+        drop_if_stale();
+
+        for (size_t i = 0; i < PATH_CACHE; ++i) {
+            if (matches(entries[i], h, path)) return &entries[i];
+        }
+
+        return nullptr;
+    }
+
+    void remember(const char* path, uint32_t first_sector, uint32_t size, uint16_t dir_index, uint8_t attributes) {
+        entry_t* e = add(path);
+
+        if (!e) return;
+
+        e->first_sector = first_sector;
+        e->size         = size;
+        e->dir_index    = dir_index;
+        e->attributes   = attributes;
+        e->found        = true;
+        e->in_root      = !strchr(e->path, '/');
+    }
+
+    void rememberMissing(const char* path) {
+        entry_t* e = add(path);
+
+        if (!e) return;
+
+        e->found   = false;
+        e->in_root = false;
+    }
+
+    void clear() {
+        stale = true;
+    }
+}
\ No newline at end of file
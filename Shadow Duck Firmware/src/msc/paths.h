@@ -0,0 +1,32 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#pragma once
+
+#include <stdint.h> // uint32_t
+
+#include "config.h"
+
+// What msc::exists() and msc::open() found for the last PATH_CACHE paths,
+// so they don't have to search the directories on flash again.
+// Has to be cleared whenever the file system changes.
+namespace paths {
+    typedef struct entry_t {
+        uint32_t hash;                 // Of the path (case-insensitive), 0 if the entry is free
+        char     path[PATH_CACHE_LEN]; // Without leading '/', longer paths aren't cached
+        uint32_t first_sector;         // Of the first cluster (SdFat doesn't expose the cluster number)
+        uint32_t size;
+        uint16_t dir_index;            // In the root directory (if in_root)
+        uint8_t  attributes;
+        bool     found;                // false remembers that the path doesn't exist
+        bool     in_root;
+    } entry_t;
+
+    // nullptr if the path isn't cached
+    const entry_t* find(const char* path);
+
+    void remember(const char* path, uint32_t first_sector, uint32_t size, uint16_t dir_index, uint8_t attributes);
+    void rememberMissing(const char* path);
+
+    // Forgets everything (can be called from interrupts, it takes effect with the next find())
+    void clear();
+}
\ No newline at end of file
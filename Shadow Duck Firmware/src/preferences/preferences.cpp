@@ -5,49 +5,79 @@
 #include "config.h"
 #include "debug.h"
 
+#include <stdlib.h> // strtol
+#include <string.h> // strncpy
+
 #include <ArduinoJson.h>
 #include "msc/msc.h"
+#include "preferences/snapshot.h"
+
+#define JSON_SIZE 1536 // Text of the file
+
+// Strings aren't copied into the documents, they point into the text or settings
+#define JSON_DOC_SIZE (JSON_OBJECT_SIZE(32) + 3 * JSON_ARRAY_SIZE(4))
+#define JSON_FILTER_SIZE JSON_OBJECT_SIZE(32)
+
+#define VALUE_LEN 16  // IDs and layout name
+#define STRING_LEN 64 // USB strings
+#define PATH_LEN 128
 
-#define JSON_SIZE 1536
+// Increase when settings_t changes, so an old snapshot isn't used
+#define SETTINGS_VERSION 3
 
 /*
    How to add new settings:
-   1. Add a variable in the top of the namespace
+   1. Add a variable to settings_t (and increase SETTINGS_VERSION)
    2. Add it to toJSON()
-   3. Add it to load() (missing values)
-   4. Add it to load() (fetching)
-   5. Add getter functions and add then to the .h file
+   3. Add it to make_filter()
+   4. Add it to reset() (missing values)
+   5. Add it to load() (fetching)
+   6. Add getter functions and add then to the .h file
  */
 
 namespace preferences {
     // ========== PRIVATE ========= //
-    bool enable_msc;
-    bool enable_led;
-    bool enable_hid;
-
-    std::string vid;
-    std::string pid;
-    std::string version;
-    std::string serial;
-    std::string manufacturer;
-    std::string product;
-
-    std::string default_layout;
-    int default_delay;
-
-    std::string main_script;
-
-    int attack_color[4];
-    int setup_color[4];
-    int idle_color[4];
-
-    bool format;
-    std::string drive_name;
-
-    bool disable_capslock;
-    bool run_on_indicator;
-
-    int initial_delay;
+    // Plain data (no pointers), so it can be stored as a binary snapshot
+    typedef struct settings_t {
+        bool enable_msc;
+        bool enable_led;
+        bool enable_hid;
+        bool enable_nkro;
+
+        char vid[VALUE_LEN];
+        char pid[VALUE_LEN];
+        char version[VALUE_LEN];
+        char serial[STRING_LEN];
+        char manufacturer[STRING_LEN];
+        char product[STRING_LEN];
+
+        char default_layout[VALUE_LEN];
+        int  default_delay;
+
+        char main_script[PATH_LEN];
+
+        int attack_color[4];
+        int setup_color[4];
+        int idle_color[4];
+
+        bool disable_capslock;
+        bool run_on_indicator;
+
+        int  initial_delay;
+        bool fast_start;
+    } settings_t;
+
+    settings_t settings;
+
+    // A format request of the file, not part of the snapshot (the file loses it once it's saved)
+    bool format = false;
+    char drive_name[12];
+
+    template<size_t N>
+    void copy(char (& str)[N], const char* value) {
+        strncpy(str, value ? value : "", N - 1);
+        str[N - 1] = '\0';
+    }
 
     // Array help functions
     void add_array(JsonDocument& doc, const char* name, int* array, int size) {
@@ -61,30 +91,75 @@ namespace preferences {
     void toJson(JsonDocument& root) {
         root["$schema"] = "https://raw.githubusercontent.com/KobolSystems/ShadowDuck_Firmware/main/Shadow%20Duck%20Firmware/src/schema.json";
 
-        root["enable_msc"] = enable_msc;
-        root["enable_led"] = enable_led;
-        root["enable_hid"] = enable_hid;
+        root["enable_msc"]  = settings.enable_msc;
+        root["enable_led"]  = settings.enable_led;
+        root["enable_hid"]  = settings.enable_hid;
+        root["enable_nkro"] = settings.enable_nkro;
+
+        root["vid"]          = (const char*)settings.vid;
+        root["pid"]          = (const char*)settings.pid;
+        root["version"]      = (const char*)settings.version;
+        root["serial"]       = (const char*)settings.serial;
+        root["manufacturer"] = (const char*)settings.manufacturer;
+        root["product"]      = (const char*)settings.product;
+
+        root["default_layout"] = (const char*)settings.default_layout;
+        root["default_delay"]  = settings.default_delay;
+
+        root["main_script"] = (const char*)settings.main_script;
 
-        root["vid"]          = vid;
-        root["pid"]          = pid;
-        root["version"]      = version;
-        root["serial"]       = serial;
-        root["manufacturer"] = manufacturer;
-        root["product"]      = product;
+        add_array(root, "attack_color", settings.attack_color, 4);
+        add_array(root, "setup_color", settings.setup_color, 4);
+        add_array(root, "idle_color", settings.idle_color, 4);
 
-        root["default_layout"] = default_layout;
-        root["default_delay"]  = default_delay;
+        root["disable_capslock"] = settings.disable_capslock;
+        root["run_on_indicator"] = settings.run_on_indicator;
 
-        root["main_script"] = main_script;
+        root["initial_delay"] = settings.initial_delay;
+        root["fast_start"]    = settings.fast_start;
+    }
+
+    // Only these are kept when parsing the file
+    void make_filter(JsonDocument& filter) {
+        filter["enable_msc"]  = true;
+        filter["enable_led"]  = true;
+        filter["enable_hid"]  = true;
+        filter["enable_nkro"] = true;
+
+        filter["vid"]          = true;
+        filter["pid"]          = true;
+        filter["version"]      = true;
+        filter["serial"]       = true;
+        filter["manufacturer"] = true;
+        filter["product"]      = true;
+
+        filter["default_layout"] = true;
+        filter["default_delay"]  = true;
 
-        add_array(root, "attack_color", attack_color, 4);
-        add_array(root, "setup_color", setup_color, 4);
-        add_array(root, "idle_color", idle_color, 4);
+        filter["main_script"] = true;
 
-        root["disable_capslock"] = disable_capslock;
-        root["run_on_indicator"] = run_on_indicator;
+        filter["attack_color"] = true;
+        filter["setup_color"]  = true;
+        filter["idle_color"]   = true;
 
-        root["initial_delay"] = initial_delay;
+        filter["format"] = true;
+
+        filter["disable_capslock"] = true;
+        filter["run_on_indicator"] = true;
+
+        filter["initial_delay"] = true;
+        filter["fast_start"]    = true;
+    }
+
+    // Pretty printed settings, returns the length (0 if they don't fit)
+    size_t to_text(char* buffer, size_t size) {
+        StaticJsonDocument<JSON_DOC_SIZE> json_doc;
+
+        toJson(json_doc);
+
+        size_t len = serializeJsonPretty(json_doc, buffer, size);
+
+        return len < size - 1 ? len : 0;
     }
 
     void read_array(JsonDocument& doc, const char* name, int* array, int size) {
@@ -107,21 +182,37 @@ namespace preferences {
         val = new_val.as<T>();
     }
 
+    // Strings are cut off if they don't fit
+    template<size_t N>
+    void read_string(JsonDocument& doc, const char* name, char (& str)[N]) {
+        JsonVariant new_val = doc[name];
+
+        if (new_val.isNull()) return;
+        copy(str, new_val.as<const char*>());
+    }
+
     // ======== PUBLIC ======== //
     void load() {
+        // Settings are the same as last time, unless the host changed a file since then
+        if (snapshot::load(&settings, sizeof(settings_t), SETTINGS_VERSION)) {
+            debugln("Loaded settings snapshot");
+            return;
+        }
+
         // Read config file
-        char* buffer = (char*)calloc(JSON_SIZE, sizeof(char));
-        DynamicJsonDocument config_doc(JSON_SIZE);
+        char buffer[JSON_SIZE];
+        StaticJsonDocument<JSON_DOC_SIZE> config_doc;
+        StaticJsonDocument<JSON_FILTER_SIZE> filter;
+
+        make_filter(filter);
 
         // Open the file and read it into a buffer
-        if (!msc::open(PREFERENCES_PATH), false) return;
+        if (!msc::open(PREFERENCES_PATH, false)) return;
         size_t read = msc::read(buffer, JSON_SIZE);
         msc::close();
 
-        // Deserialize the JSON document
-        DeserializationError error = deserializeJson(config_doc, buffer);
-
-        free(buffer);
+        // Deserialize the JSON document (strings stay in buffer)
+        DeserializationError error = deserializeJson(config_doc, buffer, read, DeserializationOption::Filter(filter));
 
         // Test if parsing succeeds.
         if (error) {
@@ -131,194 +222,200 @@ namespace preferences {
         }
 
         // === Fetch values === //
-        read_item<bool>(config_doc, "enable_msc", enable_msc);
-        read_item<bool>(config_doc, "enable_led", enable_led);
-        read_item<bool>(config_doc, "enable_hid", enable_hid);
+        read_item<bool>(config_doc, "enable_msc", settings.enable_msc);
+        read_item<bool>(config_doc, "enable_led", settings.enable_led);
+        read_item<bool>(config_doc, "enable_hid", settings.enable_hid);
+        read_item<bool>(config_doc, "enable_nkro", settings.enable_nkro);
 
-        read_item<std::string>(config_doc, "vid", vid);
-        read_item<std::string>(config_doc, "pid", pid);
-        read_item<std::string>(config_doc, "version", version);
-        read_item<std::string>(config_doc, "serial", serial);
-        read_item<std::string>(config_doc, "manufacturer", manufacturer);
-        read_item<std::string>(config_doc, "product", product);
+        read_string(config_doc, "vid", settings.vid);
+        read_string(config_doc, "pid", settings.pid);
+        read_string(config_doc, "version", settings.version);
+        read_string(config_doc, "serial", settings.serial);
+        read_string(config_doc, "manufacturer", settings.manufacturer);
+        read_string(config_doc, "product", settings.product);
 
-        read_item<std::string>(config_doc, "default_layout", default_layout);
-        read_item<int>(config_doc, "default_delay", default_delay);
+        read_string(config_doc, "default_layout", settings.default_layout);
+        read_item<int>(config_doc, "default_delay", settings.default_delay);
 
-        read_item<std::string>(config_doc, "main_script", main_script);
+        read_string(config_doc, "main_script", settings.main_script);
 
-        read_array(config_doc, "attack_color", attack_color, 4);
-        read_array(config_doc, "setup_color", setup_color, 4);
-        read_array(config_doc, "idle_color", idle_color, 4);
+        read_array(config_doc, "attack_color", settings.attack_color, 4);
+        read_array(config_doc, "setup_color", settings.setup_color, 4);
+        read_array(config_doc, "idle_color", settings.idle_color, 4);
 
         // Format Flash (Drive name/Disk label max 11 characters)
         format = config_doc.containsKey("format");
         if (format) {
-            drive_name = config_doc["format"].as<std::string>().substr(0, 11);
+            read_string(config_doc, "format", drive_name);
         }
 
-        disable_capslock = config_doc["disable_capslock"].as<bool>();
-        run_on_indicator = config_doc["run_on_indicator"].as<bool>();
+        settings.disable_capslock = config_doc["disable_capslock"].as<bool>();
+        settings.run_on_indicator = config_doc["run_on_indicator"].as<bool>();
+
+        settings.initial_delay = config_doc["initial_delay"].as<int>();
+        read_item<bool>(config_doc, "fast_start", settings.fast_start);
 
-        initial_delay = config_doc["initial_delay"].as<int>();
+        // Without a snapshot the file is read again, until a setup boot did the format
+        if (!format) snapshot::save(&settings, sizeof(settings_t), SETTINGS_VERSION);
     }
 
     void save() {
-        // Create a new JSON document (and string buffer)
-        DynamicJsonDocument json_doc(JSON_SIZE);
-        // JsonObject json_obj = json_doc.as<JsonObject>();
-        std::string json_str = { "" };
+        char   buffer[JSON_SIZE];
+        size_t len = to_text(buffer, JSON_SIZE);
 
-        // Add values
-        toJson(json_doc);
-
-        // Serialize JSON to buffer
-        serializeJsonPretty(json_doc, json_str);
-        json_doc.clear();
+        if (len == 0) {
+            debugln("Preferences don't fit into JSON_SIZE");
+            return;
+        }
 
         // Write the buffer to file (and print results)
-        debugln(json_str.c_str());
-        msc::write(PREFERENCES_PATH, json_str.c_str(), json_str.length());
+        debugln(buffer);
+        msc::write(PREFERENCES_PATH, buffer, len);
 
         debug("Saved ");
         debugln(PREFERENCES_PATH);
+
+        snapshot::save(&settings, sizeof(settings_t), SETTINGS_VERSION);
     }
 
     void reset() {
-        enable_msc = false;
-        enable_led = true;
-        enable_hid = true;
-
-        vid          = "16D0";
-        pid          = "11A4";
-        version      = "0100";
-        serial       = "1337";
-        manufacturer = "KobolSystems";
-        product      = "ShadowDuck";
-
-        default_layout = "US";
-        default_delay  = 5;
-
-        main_script = "main_script.txt";
-
-        attack_color[0] = 128;
-        attack_color[1] = 0;
-        attack_color[2] = 0;
-        attack_color[3] = 0;
-
-        setup_color[0] = 0;
-        setup_color[1] = 0;
-        setup_color[2] = 20;
-        setup_color[3] = 0;
-
-        idle_color[0] = 0;
-        idle_color[1] = 30;
-        idle_color[2] = 0;
-        idle_color[3] = 0;
-
-        format     = false;
-        drive_name = "ShadowDuck";
-
-        disable_capslock = true;
-        run_on_indicator = false;
+        settings.enable_msc  = false;
+        settings.enable_led  = true;
+        settings.enable_hid  = true;
+        settings.enable_nkro = false;
+
+        copy(settings.vid, "16D0");
+        copy(settings.pid, "11A4");
+        copy(settings.version, "0100");
+        copy(settings.serial, "1337");
+        copy(settings.manufacturer, "KobolSystems");
+        copy(settings.product, "ShadowDuck");
+
+        copy(settings.default_layout, "US");
+        settings.default_delay = 5;
+
+        copy(settings.main_script, "main_script.txt");
+
+        settings.attack_color[0] = 128;
+        settings.attack_color[1] = 0;
+        settings.attack_color[2] = 0;
+        settings.attack_color[3] = 0;
+
+        settings.setup_color[0] = 0;
+        settings.setup_color[1] = 0;
+        settings.setup_color[2] = 20;
+        settings.setup_color[3] = 0;
+
+        settings.idle_color[0] = 0;
+        settings.idle_color[1] = 30;
+        settings.idle_color[2] = 0;
+        settings.idle_color[3] = 0;
+
+        format = false;
+        copy(drive_name, "ShadowDuck");
+
+        settings.disable_capslock = true;
+        settings.run_on_indicator = false;
+
+        settings.initial_delay = 1000;
+        settings.fast_start    = false;
+    }
 
-        initial_delay = 1000;
+    void invalidate() {
+        snapshot::invalidate();
     }
 
     void print() {
-        // Create a new JSON document (and string buffer)
-        DynamicJsonDocument json_doc(JSON_SIZE);
-        // JsonObject json_obj = json_doc.as<JsonObject>();
-        std::string json_str = { "" };
+        char buffer[JSON_SIZE];
 
-        // Add values
-        toJson(json_doc);
-
-        // Serialize JSON to buffer
-        serializeJsonPretty(json_doc, json_str);
-        json_doc.clear();
-
-        // Write the buffer to file (and print results)
-        debugln(json_str.c_str());
+        if (to_text(buffer, JSON_SIZE) > 0) debugln(buffer);
     }
 
     bool mscEnabled() {
-        return enable_msc;
+        return settings.enable_msc;
     }
 
     bool ledEnabled() {
-        return enable_led;
+        return settings.enable_led;
     }
 
     bool hidEnabled() {
-        return enable_hid;
+        return settings.enable_hid;
+    }
+
+    bool nkroEnabled() {
+        return settings.enable_nkro;
     }
 
     uint16_t getVID() {
-        return std::stoi(vid, nullptr, 16);
+        return strtol(settings.vid, nullptr, 16);
     }
 
     uint16_t getPID() {
-        return std::stoi(pid, nullptr, 16);
+        return strtol(settings.pid, nullptr, 16);
     }
 
     uint16_t getVersion() {
-        return std::stoi(version, nullptr, 16);
+        return strtol(settings.version, nullptr, 16);
     }
 
-    std::string getSerial() {
-        return serial;
+    const char* getSerial() {
+        return settings.serial;
     }
 
-    std::string getManufacturer() {
-        return manufacturer;
+    const char* getManufacturer() {
+        return settings.manufacturer;
     }
 
-    std::string getProduct() {
-        return product;
+    const char* getProduct() {
+        return settings.product;
     }
 
-    std::string getDefaultLayout() {
-        return default_layout;
+    const char* getDefaultLayout() {
+        return settings.default_layout;
     }
 
     int getDefaultDelay() {
-        return default_delay;
+        return settings.default_delay;
     }
 
-    std::string getMainScript() {
-        return main_script;
+    const char* getMainScript() {
+        return settings.main_script;
     }
 
     int* getAttackColor() {
-        return attack_color;
+        return settings.attack_color;
     }
 
     int* getSetupColor() {
-        return setup_color;
+        return settings.setup_color;
     }
 
     int* getIdleColor() {
-        return idle_color;
+        return settings.idle_color;
     }
 
     bool getFormat() {
         return format;
     }
 
-    std::string getDriveName() {
+    const char* getDriveName() {
         return drive_name;
     }
 
     bool getDisableCapslock() {
-        return disable_capslock;
+        return settings.disable_capslock;
     }
 
     bool getRunOnIndicator() {
-        return run_on_indicator;
+        return settings.run_on_indicator;
     }
 
     int getInitialDelay() {
-        return initial_delay;
+        return settings.initial_delay;
+    }
+
+    bool getFastStart() {
+        return settings.fast_start;
     }
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <string>
+#include <stdint.h> // uint16_t
 
 namespace preferences {
     void load();
@@ -8,32 +8,37 @@ namespace preferences {
     void reset();
     void print();
 
+    // Settings file might have been changed (by the host), next load() has to read it
+    void invalidate();
+
     bool mscEnabled();
     bool ledEnabled();
     bool hidEnabled();
+    bool nkroEnabled();
 
     uint16_t getVID();
     uint16_t getPID();
     uint16_t getVersion();
 
-    std::string getSerial();
-    std::string getManufacturer();
-    std::string getProduct();
+    const char* getSerial();
+    const char* getManufacturer();
+    const char* getProduct();
 
-    std::string getDefaultLayout();
+    const char* getDefaultLayout();
     int getDefaultDelay();
 
-    std::string getMainScript();
+    const char* getMainScript();
 
     int* getAttackColor();
     int* getSetupColor();
     int* getIdleColor();
 
     bool getFormat();
-    std::string getDriveName();
+    const char* getDriveName();
 
     bool getDisableCapslock();
     bool getRunOnIndicator();
 
     int getInitialDelay();
+    bool getFastStart();
 }
\ No newline at end of file
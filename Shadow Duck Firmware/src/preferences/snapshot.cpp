@@ -0,0 +1,154 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#include "preferences/snapshot.h"
+
+#include "debug.h"
+
+#include <Arduino.h>
+#include <string.h> // memcpy, memcmp, memset
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <hardware/flash.h>
+
+// Flash sector after the file system, reserved by the core for EEPROM emulation (which we don't use)
+extern uint8_t _EEPROM_start;
+#endif // if defined(ARDUINO_ARCH_RP2040)
+
+#define SNAPSHOT_MAGIC 0x46504453 // "SDPF"
+#define SNAPSHOT_VALID 0xFFFFFFFF // Programming bits to 0 doesn't need an erase
+
+namespace snapshot {
+    // ====== PRIVATE ====== //
+    typedef struct header_t {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t size;
+        uint32_t crc;   // Of the data after the header
+        uint32_t valid; // SNAPSHOT_VALID, or 0 when it was invalidated
+    } header_t;
+
+    // Whether the stored snapshot is valid, so it's only invalidated once
+    bool valid = false;
+
+    uint32_t crc32(const uint8_t* data, size_t len) {
+        uint32_t crc = 0xFFFFFFFF;
+
+        for (size_t i = 0; i < len; ++i) {
+            crc ^= data[i];
+
+            for (uint8_t j = 0; j < 8; ++j) {
+                crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+            }
+        }
+
+        return ~crc;
+    }
+
+#if defined(ARDUINO_ARCH_RP2040)
+    const uint8_t* sector = &_EEPROM_start;
+    const uint32_t offset = (uintptr_t)&_EEPROM_start - XIP_BASE;
+
+    // The flash can't be read while it's written, that includes running code from it.
+    // Same as Adafruit_FlashTransport_RP2040 does for the file system.
+    void flash_lock() {
+        noInterrupts();
+        rp2040.idleOtherCore();
+    }
+
+    void flash_unlock() {
+        rp2040.resumeOtherCore();
+        interrupts();
+    }
+
+    const header_t* stored() {
+        return (const header_t*)sector;
+    }
+
+#endif // if defined(ARDUINO_ARCH_RP2040)
+
+    // ====== PUBLIC ====== //
+    bool load(void* data, size_t size, uint16_t version) {
+#if defined(ARDUINO_ARCH_RP2040)
+        const header_t* h = stored();
+
+        valid = (h->magic == SNAPSHOT_MAGIC) && (h->valid == SNAPSHOT_VALID) &&
+                (h->version == version) && (h->size == size) &&
+                (h->crc == crc32(sector + sizeof(header_t), size));
+
+        if (!valid) return false;
+
+        memcpy(data, sector + sizeof(header_t), size);
+        return true;
+#else // if defined(ARDUINO_ARCH_RP2040)
+        return false;
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+
+    bool save(const void* data, size_t size, uint16_t version) {
+#if defined(ARDUINO_ARCH_RP2040)
+        if (size > FLASH_SECTOR_SIZE - sizeof(header_t)) return false;
+
+        header_t h;
+
+        h.magic   = SNAPSHOT_MAGIC;
+        h.version = version;
+        h.size    = size;
+        h.crc     = crc32((const uint8_t*)data, size);
+        h.valid   = SNAPSHOT_VALID;
+
+        // Saving the same settings again costs no erase
+        if ((memcmp(sector, &h, sizeof(header_t)) == 0) &&
+            (memcmp(sector + sizeof(header_t), data, size) == 0)) {
+            valid = true;
+            return true;
+        }
+
+        // The flash is programmed in whole pages, from RAM
+        uint8_t page[FLASH_PAGE_SIZE];
+        size_t  total = sizeof(header_t) + size;
+
+        flash_lock();
+        flash_range_erase(offset, FLASH_SECTOR_SIZE);
+
+        for (size_t i = 0; i < total; i += FLASH_PAGE_SIZE) {
+            memset(page, 0xFF, FLASH_PAGE_SIZE);
+
+            for (size_t j = i; j < total && j < i + FLASH_PAGE_SIZE; ++j) {
+                page[j - i] = j < sizeof(header_t) ? ((const uint8_t*)&h)[j] : ((const uint8_t*)data)[j - sizeof(header_t)];
+            }
+
+            flash_range_program(offset + i, page, FLASH_PAGE_SIZE);
+        }
+
+        flash_unlock();
+
+        valid = true;
+
+        debugln("Saved settings snapshot");
+        return true;
+#else // if defined(ARDUINO_ARCH_RP2040)
+        return false;
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+
+    void invalidate() {
+#if defined(ARDUINO_ARCH_RP2040)
+        if (!valid) return;
+
+        // Only the valid word goes from 1 to 0, the rest of the page is left as it is
+        uint8_t page[FLASH_PAGE_SIZE];
+        uint32_t zero = 0;
+
+        memset(page, 0xFF, FLASH_PAGE_SIZE);
+        memcpy(&page[offsetof(header_t, valid)], &zero, sizeof(zero));
+
+        flash_lock();
+        flash_range_program(offset, page, FLASH_PAGE_SIZE);
+        flash_unlock();
+
+        valid = false;
+
+        debugln("Invalidated settings snapshot");
+#endif // if defined(ARDUINO_ARCH_RP2040)
+    }
+}
\ No newline at end of file
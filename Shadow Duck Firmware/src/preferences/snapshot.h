@@ -0,0 +1,20 @@
+/* This software is licensed under the MIT License: https://github.com/spacehuhntech/usbnova */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint16_t
+
+// Binary copy of the parsed settings in a flash sector outside of the file system,
+// so they can be loaded without reading and parsing the JSON file.
+// Only available on the RP2040 (the sector the core reserves for EEPROM), elsewhere load() always fails.
+namespace snapshot {
+    // Copies the snapshot to data, if it is valid and has the same version and size
+    bool load(void* data, size_t size, uint16_t version);
+
+    // Stores data, the flash is only erased if it differs from the stored snapshot
+    bool save(const void* data, size_t size, uint16_t version);
+
+    // Marks the stored snapshot as outdated (without erasing the sector)
+    void invalidate();
+}
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <Arduino.h> // pinMode(), digitalRead()
 
 #include "config.h"
+#include "events/events.h"
+#include "tasks/tasks.h"
 
 #define CHANGE_DELAY 200
 
@@ -13,16 +15,27 @@ namespace selector {
     bool change_flag = false;
     Mode initial_mode;
     unsigned long change_time = 0;
+    int settle_task           = -1;
+
+    // Wakes up the main loop again once changed() is true
+    void settle() {
+        events::post(events::EVENT_SELECTOR);
+    }
 
     void isr() {
         change_flag = true;
         change_time = millis();
+
+        events::post(events::EVENT_SELECTOR);
+        tasks::schedule(settle_task, CHANGE_DELAY + 1);
     }
 
     // ===== PUBLIC ===== //
     void init() {
         pinMode(SELECTOR, INPUT_PULLUP);
-    
+
+        settle_task = tasks::add("selector", settle, 0);
+
         attachInterrupt(digitalPinToInterrupt(SELECTOR), isr, CHANGE);
 
         initial_mode = read();
@@ -2,20 +2,142 @@
 
 #include "tasks/tasks.h"
 
-#include <cstddef> // NULL
+#include "config.h"
+#include "debug.h"
+
+#include <Arduino.h> // millis(), micros(), noInterrupts()
 
 namespace tasks {
     // ====== PRIVATE ====== //
-    void (*callback)(void) = NULL;
+    typedef struct task_t {
+        const char* name;
+        void (*callback)(void);
+        uint32_t          interval; // ms between runs, 0 if it only runs when scheduled
+        volatile uint32_t due;      // millis() of the next run
+        volatile bool     armed;    // Whether it runs at due
+
+        uint32_t runs;
+        uint32_t total_time; // us
+        uint32_t max_time;   // us
+    } task_t;
+
+    task_t list[MAX_TASKS];
+    int    count = 0;
+
+    bool running = false; // A task calling update() doesn't run the others
+
+    bool valid(int id) {
+        return (id >= 0) && (id < count);
+    }
+
+    // Whether t is due and if so, arm it for the next run (atomic, as schedule() comes from interrupts)
+    bool take(task_t& t, uint32_t now) {
+        bool due = false;
+
+        noInterrupts();
+
+        if (t.armed && ((int32_t)(now - t.due) >= 0)) {
+            due     = true;
+            t.armed = t.interval > 0;
+            t.due   = now + t.interval;
+        }
+
+        interrupts();
+
+        return due;
+    }
 
     // ====== PUBLIC ====== //
-    void setCallback(void (*_callback)(void)) {
-        callback = _callback;
+    int add(const char* name, void (*callback)(void), uint32_t interval) {
+        if (count >= MAX_TASKS) return -1;
+
+        task_t& t = list[count];
+
+        t.name       = name;
+        t.callback   = callback;
+        t.interval   = interval;
+        t.due        = millis() + interval;
+        t.armed      = interval > 0;
+        t.runs       = 0;
+        t.total_time = 0;
+        t.max_time   = 0;
+
+        return count++;
+    }
+
+    void setInterval(int id, uint32_t interval) {
+        if (!valid(id)) return;
+
+        noInterrupts();
+        list[id].interval = interval;
+        list[id].due      = millis() + interval;
+        list[id].armed    = interval > 0;
+        interrupts();
+    }
+
+    void schedule(int id, uint32_t delay) {
+        if (!valid(id)) return;
+
+        list[id].due   = millis() + delay;
+        list[id].armed = true;
     }
 
     void update() {
-        if (callback != NULL) {
-            callback();
+        if (running) return;
+
+        running = true;
+
+        uint32_t now = millis();
+
+        for (int i = 0; i < count; ++i) {
+            task_t& t = list[i];
+
+            if (!take(t, now)) continue;
+
+            uint32_t start_time = micros();
+
+            t.callback();
+
+            uint32_t time = micros() - start_time;
+
+            ++t.runs;
+            t.total_time += time;
+            if (time > t.max_time) t.max_time = time;
+        }
+
+        running = false;
+    }
+
+    uint32_t next() {
+        uint32_t now = millis();
+        uint32_t res = UINT32_MAX;
+
+        for (int i = 0; i < count; ++i) {
+            if (!list[i].armed) continue;
+
+            int32_t left = (int32_t)(list[i].due - now);
+
+            if (left <= 0) return 0;
+            if ((uint32_t)left < res) res = left;
         }
-    }   
+
+        return res;
+    }
+
+    void print() {
+        debuglnF("[ = Tasks =]");
+
+        for (int i = 0; i < count; ++i) {
+            debug(list[i].name);
+            debugF(": ");
+            debug(list[i].runs);
+            debugF(" runs, ");
+            debug(list[i].total_time);
+            debugF(" us total, ");
+            debug(list[i].max_time);
+            debuglnF(" us max");
+        }
+
+        debugln();
+    }
 }
\ No newline at end of file
@@ -2,7 +2,27 @@
 
 #pragma once
 
+#include <stdint.h> // uint32_t
+
+// Background work that runs between keystrokes, whenever update() is called
+// (main loop, typing, delays). Tasks run to completion, so keep them short.
 namespace tasks {
-    void setCallback(void (*callback)(void));
+    // Runs every interval ms, or only when scheduled if interval is 0.
+    // Returns the id of the task, -1 if all MAX_TASKS are taken.
+    int add(const char* name, void (*callback)(void), uint32_t interval);
+
+    // Changes the interval (0 stops it), the next run is interval ms from now
+    void setInterval(int id, uint32_t interval);
+
+    // Runs the task once in delay ms. Can be called from interrupts.
+    void schedule(int id, uint32_t delay);
+
+    // Runs the tasks that are due
     void update();
+
+    // ms until the next task is due, UINT32_MAX if none is
+    uint32_t next();
+
+    // Runs and run time of each task
+    void print();
 }
\ No newline at end of file